@@ -0,0 +1,55 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/*************************************************************************************************/
+// the global operator new/delete which count the allocations
+
+std::size_t g_allocs = 0;
+
+void* operator new(std::size_t size) {
+    ++g_allocs;
+    if ( void *ptr = std::malloc(size ? size : 1) ) {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void *ptr, std::size_t) noexcept {
+    ::operator delete(ptr);
+}
+#endif // __cpp_sized_deallocation
+
+/*************************************************************************************************/
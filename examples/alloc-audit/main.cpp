@@ -0,0 +1,278 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <named-args/named-args.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+/*************************************************************************************************/
+// counting allocator
+
+// incremented by the replaced global `operator new`. the replacements are in the separate TU,
+// so they are not inlined into the audited calls
+extern std::size_t g_allocs;
+
+/*************************************************************************************************/
+
+// longer than the SSO buffer of the `std::string`
+const char *k_fname = "/var/lib/named-args/audit/1.txt";
+const char *k_ipaddr = "fe80:0000:0000:0000:0202:b3ff:fe1e:8329";
+const char *k_default = "/var/lib/named-args/audit/default.txt";
+
+struct {
+    NAMEDARGS_ARG(fname, std::string);
+    NAMEDARGS_ARG(fsize, int);
+    NAMEDARGS_ARG(fmode, char);
+    NAMEDARGS_ARG(ipaddr, std::string);
+    NAMEDARGS_ARG(fptr, std::unique_ptr<int>);
+    NAMEDARGS_OUT(fdata, std::string);
+} const args;
+
+/*************************************************************************************************/
+// variadic packed as tuple, as the `process_file_0()` from the `main.cpp`
+
+template<typename ...Args>
+std::size_t named_tuple(Args && ...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+    auto fname = namedargs::get(args.fname, tuple);
+    auto fsize = namedargs::get(args.fsize, tuple);
+    auto fmode = namedargs::get(args.fmode, args.fmode = 'w', tuple);
+
+    return fname.size() + fsize + fmode;
+}
+
+// the `get()` copies from the lvalue tuple, so the `named_tuple()` copies the already constructed
+// `std::string` once more than the positional call. the values are moved out of the tuple here,
+// each of them is taken only once.
+template<typename ...Args>
+std::size_t named_tuple_move(Args && ...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+    auto fname = namedargs::get(args.fname, std::move(tuple));
+    auto fsize = namedargs::get(args.fsize, std::move(tuple));
+    auto fmode = namedargs::get(args.fmode, args.fmode = 'w', std::move(tuple));
+
+    return fname.size() + fsize + fmode;
+}
+
+std::size_t positional_tuple(std::string fname, int fsize, char fmode = 'w') {
+    return fname.size() + fsize + fmode;
+}
+
+/*************************************************************************************************/
+// variadic NOT packed as tuple, as the `process_file_1()` from the `main.cpp`
+
+template<typename ...Args>
+std::size_t named_variadic(Args && ...a) {
+    auto fname = namedargs::get(args.fname, std::forward<Args>(a)...);
+    auto fsize = namedargs::get(args.fsize, std::forward<Args>(a)...);
+    auto fmode = namedargs::get(args.fmode, namedargs::def(args.fmode = 'w'), std::forward<Args>(a)...);
+
+    return fname.size() + fsize + fmode;
+}
+
+/*************************************************************************************************/
+// the expensive default value
+
+template<typename ...Args>
+std::size_t named_default(Args && ...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+    auto ipaddr = namedargs::get(args.ipaddr, args.ipaddr = k_default, tuple);
+
+    return ipaddr.size();
+}
+
+std::size_t positional_default(std::string ipaddr = k_default) {
+    return ipaddr.size();
+}
+
+/*************************************************************************************************/
+// move-only type, as the `process_file_2()` from the `main.cpp`
+
+template<typename ...Args>
+int named_move(Args && ...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+    auto fptr = namedargs::get(args.fptr, args.fptr = std::unique_ptr<int>{}, tuple);
+
+    return fptr ? *fptr : 0;
+}
+
+int positional_move(std::unique_ptr<int> fptr = std::unique_ptr<int>{}) {
+    return fptr ? *fptr : 0;
+}
+
+/*************************************************************************************************/
+// overloading, as the `examples/overload`
+
+template<typename ...Args>
+NAMEDARGS_FUNC_ENABLE(Args..., args.fname)
+(std::size_t) named_overload(Args &&...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+    auto fname = namedargs::get(args.fname, tuple);
+    auto fmode = namedargs::get(args.fmode, args.fmode = 'e', tuple);
+
+    return fname.size() + fmode;
+}
+
+template<typename ...Args>
+NAMEDARGS_FUNC_ENABLE(Args..., args.ipaddr)
+(std::size_t) named_overload(Args &&...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+    auto ipaddr = namedargs::get(args.ipaddr, tuple);
+    auto fmode = namedargs::get(args.fmode, args.fmode = 'e', tuple);
+
+    return ipaddr.size() + fmode;
+}
+
+std::size_t positional_overload_fname(std::string fname, char fmode = 'e') {
+    return fname.size() + fmode;
+}
+
+std::size_t positional_overload_ipaddr(std::string ipaddr, char fmode = 'e') {
+    return ipaddr.size() + fmode;
+}
+
+/*************************************************************************************************/
+// output args
+
+template<typename ...Args>
+NAMEDARGS_FUNC_REQUIRE(Args..., args.fdata)
+(void) named_out(Args &&...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+    auto fname = namedargs::get(args.fname, tuple);
+    std::string &fdata = namedargs::get(args.fdata, tuple);
+
+    fdata.assign(fname);
+}
+
+void positional_out(std::string fname, std::string &fdata) {
+    fdata.assign(fname);
+}
+
+/*************************************************************************************************/
+
+static int g_failed = 0;
+static std::size_t g_sink = 0;
+
+// the `known` is the number of the extra allocations of the named call which is reported,
+// but is not a failure
+template<typename Named, typename Positional>
+static void audit(const char *shape, Named named, Positional positional, std::size_t known = 0) {
+    std::size_t before = g_allocs;
+    named();
+    std::size_t n = g_allocs - before;
+
+    before = g_allocs;
+    positional();
+    std::size_t p = g_allocs - before;
+
+    std::printf("%-36s: named=%zu, positional=%zu%s\n", shape, n, p
+        ,n == p ? "" : n == p + known ? " - MISMATCH (known)" : " - MISMATCH!");
+    g_failed += n != p + known;
+}
+
+int main(int argc, char **argv) {
+    char fname[64] = {};
+    std::snprintf(fname, sizeof(fname), "%s/%s", k_fname, argc > 1 ? argv[1] : "-");
+    // as the `argv[1]`
+    char *arg = fname;
+
+    audit("tuple, all args"
+        ,[&]{ g_sink += named_tuple(args.fname = arg, args.fsize = 1, args.fmode = 'r'); }
+        ,[&]{ g_sink += positional_tuple(arg, 1, 'r'); }
+    );
+    audit("tuple, default"
+        ,[&]{ g_sink += named_tuple(args.fsize = 1, args.fname = k_fname); }
+        ,[&]{ g_sink += positional_tuple(k_fname, 1); }
+    );
+    // the `get(k, tuple)` from the lvalue tuple copies the moved in `std::string`
+    audit("tuple, std::string rvalue"
+        ,[&]{ g_sink += named_tuple(args.fname = std::string{arg}, args.fsize = 1); }
+        ,[&]{ g_sink += positional_tuple(std::string{arg}, 1); }
+        ,1
+    );
+    audit("tuple moved from, std::string rvalue"
+        ,[&]{ g_sink += named_tuple_move(args.fname = std::string{arg}, args.fsize = 1); }
+        ,[&]{ g_sink += positional_tuple(std::string{arg}, 1); }
+    );
+
+    audit("variadic, all args"
+        ,[&]{ g_sink += named_variadic(args.fmode = 'r', args.fname = arg, args.fsize = 1); }
+        ,[&]{ g_sink += positional_tuple(arg, 1, 'r'); }
+    );
+    audit("variadic, default"
+        ,[&]{ g_sink += named_variadic(args.fname = k_fname, args.fsize = 1); }
+        ,[&]{ g_sink += positional_tuple(k_fname, 1); }
+    );
+    std::string lvalue{k_fname};
+    audit("variadic, std::string lvalue"
+        ,[&]{ g_sink += named_variadic(args.fname = lvalue, args.fsize = 1); }
+        ,[&]{ g_sink += positional_tuple(lvalue, 1); }
+    );
+
+    audit("expensive default, unused"
+        ,[&]{ g_sink += named_default(args.ipaddr = k_ipaddr); }
+        ,[&]{ g_sink += positional_default(k_ipaddr); }
+    );
+    audit("expensive default, used"
+        ,[&]{ g_sink += named_default(); }
+        ,[&]{ g_sink += positional_default(); }
+    );
+
+    audit("move-only"
+        ,[&]{ g_sink += named_move(args.fptr = std::unique_ptr<int>{new int{1}}); }
+        ,[&]{ g_sink += positional_move(std::unique_ptr<int>{new int{1}}); }
+    );
+    audit("move-only, default"
+        ,[&]{ g_sink += named_move(); }
+        ,[&]{ g_sink += positional_move(); }
+    );
+
+    audit("overload, fname"
+        ,[&]{ g_sink += named_overload(args.fname = arg, args.fmode = 'r'); }
+        ,[&]{ g_sink += positional_overload_fname(arg, 'r'); }
+    );
+    audit("overload, ipaddr"
+        ,[&]{ g_sink += named_overload(args.ipaddr = k_ipaddr); }
+        ,[&]{ g_sink += positional_overload_ipaddr(k_ipaddr); }
+    );
+
+    std::string named_buf, positional_buf;
+    named_buf.reserve(64);
+    positional_buf.reserve(64);
+    audit("output arg"
+        ,[&]{ named_out(args.fdata = namedargs::out(named_buf), args.fname = arg); }
+        ,[&]{ positional_out(arg, positional_buf); }
+    );
+
+    std::printf("%s (%zu)\n", g_failed ? "FAILED" : "OK", g_sink);
+
+    return g_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/*************************************************************************************************/
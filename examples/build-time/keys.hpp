@@ -0,0 +1,65 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#ifndef __NAMED_ARGS__EXAMPLES__KEYS_HPP_INCLUDED
+#define __NAMED_ARGS__EXAMPLES__KEYS_HPP_INCLUDED
+
+// the textual includes of the standard headers precede the `import`, see `named-args.cppm`
+#include <string>
+
+#ifdef EX_IMPORT
+import named_args;
+#include <named-args/macros.hpp>
+#else
+#include <named-args/named-args.hpp>
+#endif // EX_IMPORT
+
+/*************************************************************************************************/
+
+struct {
+    NAMEDARGS_ARG(name, std::string);
+    NAMEDARGS_ARG(size, int);
+    NAMEDARGS_ARG(mode, char);
+    NAMEDARGS_FLAG(verbose, 0);
+} const files;
+
+// name    - required
+// size    - optional
+// mode    - optional
+// verbose - optional
+template<typename ...Args>
+std::size_t open_file(Args && ...a) {
+    std::string name = namedargs::get(files.name, a...);
+    int size = namedargs::get(files.size, namedargs::def(files.size = 0), a...);
+    char mode = namedargs::get(files.mode, namedargs::def(files.mode = 'r'), a...);
+    bool verbose = (namedargs::get_flags(a...) & files.verbose.mask()) != 0;
+
+    return name.size() + static_cast<std::size_t>(size) + static_cast<std::size_t>(mode) + verbose;
+}
+
+/*************************************************************************************************/
+
+#endif // __NAMED_ARGS__EXAMPLES__KEYS_HPP_INCLUDED
@@ -0,0 +1,56 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "keys.hpp"
+#include "tus.hpp"
+
+#include <cstdio>
+#include <cassert>
+
+/*************************************************************************************************/
+
+#define EX_DECLARE_TU(i) std::size_t tu_ ## i(const std::string &name);
+EX_FOR_EACH_TU(EX_DECLARE_TU)
+
+#define EX_CALL_TU(i) total += tu_ ## i(name);
+
+int main() {
+    std::string name = "file.txt";
+
+    std::size_t total = 0;
+    EX_FOR_EACH_TU(EX_CALL_TU)
+    assert(total != 0);
+
+    // the same as in the `tu_0()`
+    assert(open_file(files.name = name, files.size = 0, files.verbose = true)
+        == name.size() + 'r' + 1);
+
+    std::printf("total=%zu\n", total);
+
+    return 0;
+}
+
+/*************************************************************************************************/
@@ -0,0 +1,89 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <named-args/named-args.hpp>
+
+#include <cstdio>
+#include <cassert>
+
+/*************************************************************************************************/
+
+struct {
+    NAMEDARGS_ARG(red, unsigned);
+    NAMEDARGS_ARG(green, unsigned);
+    NAMEDARGS_ARG(blue, unsigned);
+    NAMEDARGS_ARG(alpha, unsigned);
+} constexpr holders{};
+
+struct color {
+    unsigned r, g, b, a;
+};
+
+/*************************************************************************************************/
+
+// all are optional, the color is opaque black by default
+template<typename ...Args>
+constexpr color make_color(Args &&...a) {
+    return {
+         namedargs::get(holders.red, namedargs::def(holders.red = 0u), a...)
+        ,namedargs::get(holders.green, namedargs::def(holders.green = 0u), a...)
+        ,namedargs::get(holders.blue, namedargs::def(holders.blue = 0u), a...)
+        ,namedargs::get(holders.alpha, namedargs::def(holders.alpha = 255u), a...)
+    };
+}
+
+/*************************************************************************************************/
+
+// the table is built at compile time and is placed into `.rodata`.
+// without `constexpr` (or if `make_color()` were not constexpr) it would be placed into `.bss`
+// and filled at startup by the static initialization code, check it with:
+//   nm -C ex-constexpr-table | grep -E 'palette|GLOBAL__sub'
+// which gives `r palette` here, and `b palette` + `_GLOBAL__sub_I_main` for the non-constexpr one.
+constexpr color palette[] = {
+     make_color()
+    ,make_color(holders.red = 255u)
+    ,make_color(holders.green = 255u, holders.alpha = 128u)
+    ,make_color(holders.alpha = 0u, holders.blue = 255u, holders.red = 255u)
+};
+
+static_assert(palette[0].a == 255, "");
+static_assert(palette[1].r == 255 && palette[1].g == 0, "");
+static_assert(palette[2].g == 255 && palette[2].a == 128, "");
+static_assert(palette[3].r == 255 && palette[3].b == 255 && palette[3].a == 0, "");
+
+/*************************************************************************************************/
+
+int main(int argc, char **) {
+    assert(argc == 1);
+
+    for ( const auto &it: palette ) {
+        std::printf("#%02x%02x%02x%02x\n", it.r, it.g, it.b, it.a);
+    }
+
+    return 0;
+}
+
+/*************************************************************************************************/
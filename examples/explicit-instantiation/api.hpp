@@ -0,0 +1,101 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#ifndef __NAMED_ARGS__EXAMPLES__API_HPP_INCLUDED
+#define __NAMED_ARGS__EXAMPLES__API_HPP_INCLUDED
+
+#include <named-args/named-args.hpp>
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*************************************************************************************************/
+
+// the group must be named, see `NAMEDARGS_EXTERN_TEMPLATE()`
+struct report_args {
+    NAMEDARGS_ARG(title, std::string);
+    NAMEDARGS_ARG(rows, std::vector<std::string>);
+    NAMEDARGS_ARG(width, int);
+    NAMEDARGS_ARG(sep, char);
+    NAMEDARGS_ARG(numbered, bool);
+} const rargs{};
+
+// title    - required
+// rows     - required
+// width    - optional
+// sep      - optional
+// numbered - optional
+template<typename ...Args>
+std::string make_report(Args && ...a) {
+    auto title = namedargs::get(rargs.title, a...);
+    auto rows = namedargs::get(rargs.rows, a...);
+    auto width = namedargs::get(rargs.width, namedargs::def(rargs.width = 40), a...);
+    auto sep = namedargs::get(rargs.sep, namedargs::def(rargs.sep = '-'), a...);
+    auto numbered = namedargs::get(rargs.numbered, namedargs::def(rargs.numbered = false), a...);
+
+    std::map<std::string, int> counts;
+    for ( const auto &it: rows ) {
+        ++counts[it];
+    }
+
+    std::ostringstream os;
+    os << title << '\n' << std::string(static_cast<std::size_t>(width), sep) << '\n';
+    int n = 0;
+    for ( const auto &it: counts ) {
+        if ( numbered ) {
+            os << ++n << ". ";
+        }
+        os << it.first << ": " << it.second << '\n';
+    }
+
+    return os.str();
+}
+
+/*************************************************************************************************/
+// the key combinations used by the callers
+
+
+#define EX_REPORT_BASIC_ARGS \
+     NAMEDARGS_ARG_TYPE(rargs.title, const char *) \
+    ,NAMEDARGS_ARG_TYPE(rargs.rows, std::vector<std::string>)
+
+#define EX_REPORT_FULL_ARGS \
+     NAMEDARGS_ARG_TYPE(rargs.title, const char *) \
+    ,NAMEDARGS_ARG_TYPE(rargs.rows, std::vector<std::string>) \
+    ,NAMEDARGS_ARG_TYPE(rargs.width, int) \
+    ,NAMEDARGS_ARG_TYPE(rargs.sep, char) \
+    ,NAMEDARGS_ARG_TYPE(rargs.numbered, bool)
+
+#ifdef EX_EXTERN_TEMPLATES
+NAMEDARGS_EXTERN_TEMPLATE(std::string, make_report, EX_REPORT_BASIC_ARGS);
+NAMEDARGS_EXTERN_TEMPLATE(std::string, make_report, EX_REPORT_FULL_ARGS);
+#endif // EX_EXTERN_TEMPLATES
+
+/*************************************************************************************************/
+
+#endif // __NAMED_ARGS__EXAMPLES__API_HPP_INCLUDED
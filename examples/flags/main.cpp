@@ -0,0 +1,193 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <named-args/named-args.hpp>
+
+#include <cstdio>
+#include <cassert>
+
+/*************************************************************************************************/
+// the same twelve switches, declared as the plain bool keys and as the flag keys
+
+struct {
+    NAMEDARGS_ARG(verbose, bool);
+    NAMEDARGS_ARG(recursive, bool);
+    NAMEDARGS_ARG(force, bool);
+    NAMEDARGS_ARG(dry_run, bool);
+    NAMEDARGS_ARG(follow, bool);
+    NAMEDARGS_ARG(sparse, bool);
+    NAMEDARGS_ARG(sync, bool);
+    NAMEDARGS_ARG(backup, bool);
+    NAMEDARGS_ARG(progress, bool);
+    NAMEDARGS_ARG(checksum, bool);
+    NAMEDARGS_ARG(compress, bool);
+    NAMEDARGS_ARG(preserve, bool);
+} const bools{};
+
+struct {
+    NAMEDARGS_FLAG(verbose, 0);
+    NAMEDARGS_FLAG(recursive, 1);
+    NAMEDARGS_FLAG(force, 2);
+    NAMEDARGS_FLAG(dry_run, 3);
+    NAMEDARGS_FLAG(follow, 4);
+    NAMEDARGS_FLAG(sparse, 5);
+    NAMEDARGS_FLAG(sync, 6);
+    NAMEDARGS_FLAG(backup, 7);
+    NAMEDARGS_FLAG(progress, 8);
+    NAMEDARGS_FLAG(checksum, 9);
+    NAMEDARGS_FLAG(compress, 10);
+    NAMEDARGS_FLAG(preserve, 11);
+} constexpr flags{};
+
+/*************************************************************************************************/
+// the out-of-line implementations, the public functions forward the switches to them
+
+#define NOINLINE __attribute__((noinline))
+
+NOINLINE unsigned copy_impl_bools(
+     bool verbose
+    ,bool recursive
+    ,bool force
+    ,bool dry_run
+    ,bool follow
+    ,bool sparse
+    ,bool sync
+    ,bool backup
+    ,bool progress
+    ,bool checksum
+    ,bool compress
+    ,bool preserve)
+{
+    unsigned r = 0;
+    r += verbose ? 1 : 0;
+    r += recursive ? 2 : 0;
+    r += force ? 4 : 0;
+    r += dry_run ? 8 : 0;
+    r += follow ? 16 : 0;
+    r += sparse ? 32 : 0;
+    r += sync ? 64 : 0;
+    r += backup ? 128 : 0;
+    r += progress ? 256 : 0;
+    r += checksum ? 512 : 0;
+    r += compress ? 1024 : 0;
+    r += preserve ? 2048 : 0;
+
+    return r;
+}
+
+NOINLINE unsigned copy_impl_flags(namedargs::flags_type f) {
+    unsigned r = 0;
+    r += (f & flags.verbose.mask()) ? 1 : 0;
+    r += (f & flags.recursive.mask()) ? 2 : 0;
+    r += (f & flags.force.mask()) ? 4 : 0;
+    r += (f & flags.dry_run.mask()) ? 8 : 0;
+    r += (f & flags.follow.mask()) ? 16 : 0;
+    r += (f & flags.sparse.mask()) ? 32 : 0;
+    r += (f & flags.sync.mask()) ? 64 : 0;
+    r += (f & flags.backup.mask()) ? 128 : 0;
+    r += (f & flags.progress.mask()) ? 256 : 0;
+    r += (f & flags.checksum.mask()) ? 512 : 0;
+    r += (f & flags.compress.mask()) ? 1024 : 0;
+    r += (f & flags.preserve.mask()) ? 2048 : 0;
+
+    return r;
+}
+
+// all optional, `recursive` and `preserve` are true by default
+template<typename ...Args>
+unsigned copy_bools(Args && ...a) {
+    using namespace namedargs;
+    return copy_impl_bools(
+         get(bools.verbose, def(bools.verbose = false), a...)
+        ,get(bools.recursive, def(bools.recursive = true), a...)
+        ,get(bools.force, def(bools.force = false), a...)
+        ,get(bools.dry_run, def(bools.dry_run = false), a...)
+        ,get(bools.follow, def(bools.follow = false), a...)
+        ,get(bools.sparse, def(bools.sparse = false), a...)
+        ,get(bools.sync, def(bools.sync = false), a...)
+        ,get(bools.backup, def(bools.backup = false), a...)
+        ,get(bools.progress, def(bools.progress = false), a...)
+        ,get(bools.checksum, def(bools.checksum = false), a...)
+        ,get(bools.compress, def(bools.compress = false), a...)
+        ,get(bools.preserve, def(bools.preserve = true), a...)
+    );
+}
+
+// all optional, `recursive` and `preserve` are true by default
+template<typename ...Args>
+unsigned copy_flags(Args && ...a) {
+    return copy_impl_flags(
+        namedargs::get_flags_or(namedargs::flags(flags.recursive = true, flags.preserve = true), a...)
+    );
+}
+
+/*************************************************************************************************/
+// the call sites to compare: `g++ -O2 -S main.cpp` and look at `call_site_*`
+
+NOINLINE unsigned call_site_bools_const() {
+    return copy_bools(bools.verbose = true, bools.force = true, bools.preserve = false);
+}
+
+NOINLINE unsigned call_site_flags_const() {
+    return copy_flags(flags.verbose = true, flags.force = true, flags.preserve = false);
+}
+
+NOINLINE unsigned call_site_bools_runtime(bool verbose, bool sync) {
+    return copy_bools(bools.verbose = verbose, bools.sync = sync, bools.checksum = true);
+}
+
+NOINLINE unsigned call_site_flags_runtime(bool verbose, bool sync) {
+    return copy_flags(flags.verbose = verbose, flags.sync = sync, flags.checksum = true);
+}
+
+/*************************************************************************************************/
+
+// the whole mask folds at compile time
+static_assert(
+    namedargs::get_flags_or(
+         namedargs::flags(flags.recursive = true, flags.preserve = true)
+        ,flags.verbose = true
+        ,flags.force = true
+        ,flags.preserve = false
+    ) == (flags.verbose.mask() | flags.recursive.mask() | flags.force.mask())
+    ,""
+);
+
+int main(int argc, char **) {
+    assert(call_site_bools_const() == call_site_flags_const());
+    assert(call_site_bools_const() == (1u | 2u | 4u));
+
+    bool v = argc > 0;
+    bool s = argc > 1;
+    assert(call_site_bools_runtime(v, s) == call_site_flags_runtime(v, s));
+    assert(call_site_flags_runtime(v, s) == (1u | 2u | 512u | 2048u));
+
+    std::printf("bools=%u flags=%u\n", call_site_bools_runtime(v, s), call_site_flags_runtime(v, s));
+
+    return 0;
+}
+
+/*************************************************************************************************/
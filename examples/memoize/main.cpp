@@ -0,0 +1,225 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <named-args/memoize.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cassert>
+
+/*************************************************************************************************/
+
+struct {
+    NAMEDARGS_ARG(text, std::string);
+    NAMEDARGS_ARG(seed, unsigned);
+    NAMEDARGS_ARG(rounds, int);
+} const holders;
+
+/*************************************************************************************************/
+
+static std::atomic<int> g_calls{0};
+
+// text   - required
+// seed   - optional
+// rounds - optional
+struct digest {
+    template<typename ...Args>
+    unsigned operator()(Args &&...a) const {
+        ++g_calls;
+
+        auto text = namedargs::get(holders.text, std::forward<Args>(a)...);
+        auto seed = namedargs::get(holders.seed, namedargs::def(holders.seed = 7u), std::forward<Args>(a)...);
+        auto rounds = namedargs::get(holders.rounds, namedargs::def(holders.rounds = 1), std::forward<Args>(a)...);
+
+        unsigned h = seed;
+        for ( int i = 0; i < rounds; ++i ) {
+            for ( char c: text ) {
+                h = h * 31u + static_cast<unsigned char>(c);
+            }
+        }
+
+        return h;
+    }
+};
+
+/*************************************************************************************************/
+
+using clock_type = std::chrono::steady_clock;
+
+static double ns_per_op(clock_type::time_point start, std::size_t ops) {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start);
+    return static_cast<double>(ns.count()) / static_cast<double>(ops);
+}
+
+static void check() {
+    // the defaults must be the same as in the `digest`
+    auto memo = namedargs::memoize(
+         digest{}
+        ,4
+        ,holders.text
+        ,holders.seed = 7u
+        ,holders.rounds = 1
+    );
+
+    g_calls = 0;
+    unsigned r0 = memo(holders.text = "abc", holders.rounds = 2);
+    assert(g_calls == 1);
+
+    // the order of the passed keys doesn't matter
+    unsigned r1 = memo(holders.rounds = 2, holders.text = "abc");
+    assert(r1 == r0);
+    assert(g_calls == 1);
+
+    // the absent key is the same as the key passed with its default value
+    unsigned r2 = memo(holders.text = "abc", holders.rounds = 2, holders.seed = 7u);
+    assert(r2 == r0);
+    assert(g_calls == 1);
+
+    unsigned r3 = memo(holders.text = "abc", holders.seed = 8u, holders.rounds = 2);
+    assert(r3 != r0);
+    assert(g_calls == 2);
+
+    // LRU eviction: "abc"/2/7 is touched, so "abc"/2/8 is the eldest one
+    memo(holders.text = "x");
+    memo(holders.text = "y");
+    memo(holders.text = "abc", holders.rounds = 2);
+    assert(g_calls == 4);
+    assert(memo.cache().size() == 4);
+
+    memo(holders.text = "z");
+    assert(g_calls == 5);
+    assert(memo.cache().size() == 4);
+
+    memo(holders.text = "abc", holders.rounds = 2);
+    assert(g_calls == 5);
+    memo(holders.text = "abc", holders.rounds = 2, holders.seed = 8u);
+    assert(g_calls == 6);
+
+    // the cache gives the same results as the function itself
+    auto big = namedargs::memoize(digest{}, 64, holders.text = "", holders.seed = 7u, holders.rounds = 1);
+    for ( unsigned i = 0; i < 1000; ++i ) {
+        std::string text = std::to_string(i % 100);
+        unsigned expected = digest{}(holders.text = text, holders.seed = i % 3);
+        assert(big(holders.seed = i % 3, holders.text = text) == expected);
+        assert(big.cache().size() <= 64);
+    }
+}
+
+static void bench_latency() {
+    enum : std::size_t { ops = 1000000 };
+
+    // hit latency: the same key over and over
+    auto memo = namedargs::memoize(digest{}, 1024, holders.text, holders.seed = 7u, holders.rounds = 1);
+    const std::string text(64, 'a');
+    memo(holders.text = text, holders.rounds = 16);
+    unsigned sink = 0;
+
+    auto start = clock_type::now();
+    for ( std::size_t i = 0; i < ops; ++i ) {
+        sink += memo(holders.text = text, holders.rounds = 16);
+    }
+    double hit = ns_per_op(start, ops);
+
+    // the function itself
+    start = clock_type::now();
+    for ( std::size_t i = 0; i < ops; ++i ) {
+        sink += digest{}(holders.text = text, holders.rounds = 16);
+    }
+    double call = ns_per_op(start, ops);
+
+    // miss latency: the unique keys only, with the eviction on each call
+    start = clock_type::now();
+    for ( std::size_t i = 0; i < ops; ++i ) {
+        sink += memo(holders.text = text, holders.rounds = 16, holders.seed = static_cast<unsigned>(i));
+    }
+    double miss = ns_per_op(start, ops);
+
+    std::printf("latency: call=%.1fns hit=%.1fns miss=%.1fns (sink=%u)\n", call, hit, miss, sink);
+}
+
+template<typename Memo>
+static double bench_threads(Memo &memo, std::size_t threads) {
+    enum : std::size_t { ops = 400000, distinct = 512 };
+
+    std::vector<std::string> texts;
+    for ( std::size_t i = 0; i < distinct; ++i ) {
+        texts.push_back(std::string(48, 'a') + std::to_string(i));
+    }
+
+    std::atomic<unsigned> sink{0};
+    std::vector<std::thread> pool;
+    auto start = clock_type::now();
+    for ( std::size_t t = 0; t < threads; ++t ) {
+        pool.emplace_back([&memo, &texts, &sink, t]() {
+            unsigned local = 0;
+            for ( std::size_t i = 0; i < ops; ++i ) {
+                const std::string &text = texts[(i * 7 + t) % distinct];
+                local += memo(holders.text = text, holders.rounds = 4);
+            }
+            sink += local;
+        });
+    }
+    for ( auto &it: pool ) {
+        it.join();
+    }
+
+    // the total throughput, in ns per call
+    return ns_per_op(start, ops * threads);
+}
+
+// the scaling is seen only if the threads run in parallel, with the single hardware
+// thread the numbers are flat for any number of threads and shards.
+static void bench_scaling() {
+    unsigned cores = std::thread::hardware_concurrency();
+    std::printf("hardware threads: %u\n", cores);
+    for ( std::size_t threads = 1; threads <= 8; threads *= 2 ) {
+        auto single = namedargs::memoize_sharded(
+            digest{}, 1, 1024, holders.text, holders.seed = 7u, holders.rounds = 1);
+        auto sharded = namedargs::memoize_sharded(
+            digest{}, 16, 1024, holders.text, holders.seed = 7u, holders.rounds = 1);
+
+        double s1 = bench_threads(single, threads);
+        double s16 = bench_threads(sharded, threads);
+        std::printf("threads=%zu: 1-shard=%.1fns/call 16-shards=%.1fns/call%s\n"
+            ,threads, s1, s16, threads > cores ? " (oversubscribed)" : "");
+    }
+}
+
+/*************************************************************************************************/
+
+int main() {
+    check();
+    bench_latency();
+    bench_scaling();
+
+    return 0;
+}
+
+/*************************************************************************************************/
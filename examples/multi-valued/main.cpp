@@ -0,0 +1,129 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// the single-valued key passed more than once is a compile-time error
+#define NAMEDARGS_REJECT_DUPLICATES 1
+
+#include <named-args/named-args.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <cassert>
+
+/*************************************************************************************************/
+// the heap allocations counter
+
+static std::size_t g_allocs = 0;
+
+void* operator new(std::size_t size) {
+    ++g_allocs;
+    if ( void *p = std::malloc(size) ) {
+        return p;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+#endif // __cpp_sized_deallocation
+
+/*************************************************************************************************/
+
+struct {
+    NAMEDARGS_ARG(host, const char *);
+    NAMEDARGS_ARG(timeout, int);
+    NAMEDARGS_MULTI(port, int);
+    NAMEDARGS_ARG(ports, std::vector<int>);
+} const holders{};
+
+// host    - required
+// timeout - optional
+// port    - optional, multi-valued
+template<typename ...Args>
+int listen(Args && ...a) {
+    const char *host = namedargs::get(holders.host, a...);
+    int timeout = namedargs::get(holders.timeout, namedargs::def(holders.timeout = 30), a...);
+
+    // `std::array<int, N>` on the stack, N is the number of the passed `port`s
+    auto ports = namedargs::get_all(holders.port, a...);
+
+    int sum = 0;
+    for ( int port: ports ) {
+        sum += port;
+    }
+
+    return host[0] + timeout + sum;
+}
+
+// the same with the `std::vector` argument
+template<typename ...Args>
+int listen_vector(Args && ...a) {
+    const char *host = namedargs::get(holders.host, a...);
+    int timeout = namedargs::get(holders.timeout, namedargs::def(holders.timeout = 30), a...);
+    std::vector<int> ports = namedargs::get(holders.ports, std::forward<Args>(a)...);
+
+    int sum = 0;
+    for ( int port: ports ) {
+        sum += port;
+    }
+
+    return host[0] + timeout + sum;
+}
+
+/*************************************************************************************************/
+
+int main() {
+    g_allocs = 0;
+    int r0 = listen(holders.port = 80, holders.host = "h", holders.port = 443, holders.port = 8080);
+    std::size_t multi_allocs = g_allocs;
+    assert(multi_allocs == 0);
+
+    g_allocs = 0;
+    int r1 = listen_vector(holders.host = "h", holders.ports = std::vector<int>{80, 443, 8080});
+    std::size_t vector_allocs = g_allocs;
+    assert(vector_allocs != 0);
+
+    assert(r0 == r1);
+    assert(listen(holders.host = "h", holders.timeout = 0) == 'h');
+
+    // does not compile, the `timeout` is passed twice:
+    // listen(holders.host = "h", holders.timeout = 1, holders.timeout = 2);
+
+    std::printf("multi-valued: %zu allocs, std::vector: %zu allocs\n", multi_allocs, vector_allocs);
+
+    return 0;
+}
+
+/*************************************************************************************************/
@@ -0,0 +1,171 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <named-args/named-args.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cassert>
+
+/*************************************************************************************************/
+// the default resource which counts the allocations on the global heap
+
+struct counting_resource: std::pmr::memory_resource {
+    std::atomic<std::size_t> allocs{0};
+
+    void* do_allocate(std::size_t bytes, std::size_t align) override {
+        ++allocs;
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void *p, std::size_t bytes, std::size_t align) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+    bool do_is_equal(const std::pmr::memory_resource &r) const noexcept override {
+        return this == &r;
+    }
+};
+
+static counting_resource g_heap;
+
+/*************************************************************************************************/
+
+struct {
+    NAMEDARGS_ALLOC(alloc, std::pmr::polymorphic_allocator<char>);
+    NAMEDARGS_ARG(method, std::pmr::string);
+    NAMEDARGS_ARG(path, std::pmr::string);
+    NAMEDARGS_ARG(host, std::pmr::string);
+    NAMEDARGS_ARG(agent, std::pmr::string);
+    NAMEDARGS_ARG(accept, std::pmr::string);
+} const holders{};
+
+// alloc  - optional, the global heap by default
+// method - optional
+// path   - required
+// host   - required
+// agent  - optional
+// accept - optional
+template<typename ...Args>
+std::size_t handle_request(Args && ...a) {
+    auto method = namedargs::get(holders.method, namedargs::def(holders.method = "GET"), a...);
+    auto path = namedargs::get(holders.path, a...);
+    auto host = namedargs::get(holders.host, a...);
+    auto agent = namedargs::get(holders.agent, namedargs::def(holders.agent = "named-args-benchmark/1.0 (linux)"), a...);
+    auto accept = namedargs::get(holders.accept, namedargs::def(holders.accept = "text/html,application/xhtml+xml"), a...);
+
+    // the request-local data uses the same allocator
+    std::pmr::polymorphic_allocator<char> alloc = namedargs::get(
+        holders.alloc, namedargs::def(holders.alloc = std::pmr::get_default_resource()), a...);
+    std::pmr::vector<std::pmr::string> segments(alloc);
+    std::size_t from = 1;
+    for ( std::size_t pos = path.find('/', from); ; pos = path.find('/', from) ) {
+        segments.emplace_back(path, from, pos - from);
+        if ( pos == std::pmr::string::npos ) {
+            break;
+        }
+        from = pos + 1;
+    }
+
+    std::size_t r = method.size() + host.size() + agent.size() + accept.size();
+    for ( const auto &it: segments ) {
+        r += it.size();
+    }
+
+    return r;
+}
+
+/*************************************************************************************************/
+
+using clock_type = std::chrono::steady_clock;
+
+static const char *k_path = "/api/v1/organizations/named-args/repositories/examples/pmr-arena";
+static const char *k_host = "internal-service.cluster.example.com";
+
+template<bool Arena>
+static std::size_t handle_one() {
+    if constexpr ( Arena ) {
+        char buf[4096];
+        std::pmr::monotonic_buffer_resource arena{buf, sizeof(buf)};
+        return handle_request(holders.alloc = &arena, holders.path = k_path, holders.host = k_host);
+    } else {
+        return handle_request(holders.path = k_path, holders.host = k_host);
+    }
+}
+
+template<bool Arena>
+static double bench(std::size_t threads, std::size_t &allocs) {
+    enum : std::size_t { ops = 200000 };
+
+    std::atomic<std::size_t> sink{0};
+    std::vector<std::thread> pool;
+    std::size_t allocs_before = g_heap.allocs;
+    auto start = clock_type::now();
+    for ( std::size_t t = 0; t < threads; ++t ) {
+        pool.emplace_back([&sink]() {
+            std::size_t local = 0;
+            for ( std::size_t i = 0; i < ops; ++i ) {
+                local += handle_one<Arena>();
+            }
+            sink += local;
+        });
+    }
+    for ( auto &it: pool ) {
+        it.join();
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start);
+
+    assert(sink == handle_one<Arena>() * ops * threads);
+    allocs = (g_heap.allocs - allocs_before) / (ops * threads);
+
+    // the total throughput, in ns per request
+    return static_cast<double>(ns.count()) / static_cast<double>(ops * threads);
+}
+
+/*************************************************************************************************/
+
+int main() {
+    std::pmr::set_default_resource(&g_heap);
+
+    assert(handle_one<true>() == handle_one<false>());
+
+    for ( std::size_t threads = 1; threads <= 8; threads *= 2 ) {
+        std::size_t heap_allocs = 0, arena_allocs = 0;
+        double heap = bench<false>(threads, heap_allocs);
+        double arena = bench<true>(threads, arena_allocs);
+        std::printf(
+             "threads=%zu: heap=%.1fns/req (%zu allocs/req) arena=%.1fns/req (%zu allocs/req)\n"
+            ,threads, heap, heap_allocs, arena, arena_allocs
+        );
+    }
+
+    return 0;
+}
+
+/*************************************************************************************************/
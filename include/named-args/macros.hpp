@@ -0,0 +1,156 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#ifndef __NAMED_ARGS__MACROS_HPP_INCLUDED
+#define __NAMED_ARGS__MACROS_HPP_INCLUDED
+
+// the macros of the library, included by the `named-args.hpp`.
+// include it directly only after the `import named_args;`, the macros can't be exported
+// by the module. the expansions refer to the `::namedargs` names only.
+
+/*************************************************************************************************/
+
+#define NAMEDARGS_PARENTHESIS_MUST_BE_PLACED_AROUND_THE_RETURN_TYPE(...) __VA_ARGS__>::type
+
+#define NAMEDARGS_FUNC_ENABLE(VARIADIC, ...) \
+    typename ::namedargs::details::enable_ret_holder< \
+        ::namedargs::details::multi_contains<::namedargs::details::types_list<decltype(__VA_ARGS__)> \
+            ,VARIADIC>::value == true \
+                ,NAMEDARGS_PARENTHESIS_MUST_BE_PLACED_AROUND_THE_RETURN_TYPE
+
+#define NAMEDARGS_FUNC_DISABLE(VARIADIC, ...) \
+    typename ::namedargs::details::enable_ret_holder< \
+        ::namedargs::details::multi_contains<::namedargs::details::types_list<decltype(__VA_ARGS__)> \
+            ,VARIADIC>::value == false \
+                ,NAMEDARGS_PARENTHESIS_MUST_BE_PLACED_AROUND_THE_RETURN_TYPE
+
+#define NAMEDARGS_FUNC_REQUIRE(VARIADIC, ...) \
+    typename ::namedargs::details::required_ret_holder< \
+        ::namedargs::details::multi_contains<::namedargs::details::types_list<decltype(__VA_ARGS__)> \
+            ,VARIADIC>::value == true \
+                ,NAMEDARGS_PARENTHESIS_MUST_BE_PLACED_AROUND_THE_RETURN_TYPE
+
+#define NAMEDARGS_FUNC_REFUSE(VARIADIC, ...) \
+    typename ::namedargs::details::refused_ret_holder< \
+        ::namedargs::details::multi_contains<::namedargs::details::types_list<decltype(__VA_ARGS__)> \
+            ,VARIADIC>::value == false \
+                ,NAMEDARGS_PARENTHESIS_MUST_BE_PLACED_AROUND_THE_RETURN_TYPE
+
+/*************************************************************************************************/
+
+// the pack element type for the `key = value` arg where `value` is of `type_`:
+// `NAMEDARGS_ARG_TYPE(args.fname, const char *)`
+#define NAMEDARGS_ARG_TYPE(key, ...) \
+    ::namedargs::arg_type<decltype(key), __VA_ARGS__>
+
+// the instantiation of the named-args function for the specified pack element types.
+// `NAMEDARGS_EXTERN_TEMPLATE()` goes to the header after the function template, and
+// `NAMEDARGS_INSTANTIATE()` with the same arguments goes to the single .cpp, thus the
+// body is compiled once instead of in each TU. the order of the element types must be
+// the same as the order of args at the call site.
+// the args-group must be a named type, the instantiations for the anonymous
+// `struct {...} const args;` group has the internal linkage and can't be shared.
+#define NAMEDARGS_EXTERN_TEMPLATE(ret, func, ...) \
+    extern template ::namedargs::signature<ret, __VA_ARGS__> func<__VA_ARGS__>
+
+#define NAMEDARGS_INSTANTIATE(ret, func, ...) \
+    template ::namedargs::signature<ret, __VA_ARGS__> func<__VA_ARGS__>
+
+/*************************************************************************************************/
+
+#define NAMEDARGS_ARG(name, type_) \
+    struct name ## _t { \
+        using type = type_; \
+        type v; \
+        template<typename U> \
+        constexpr typename ::namedargs::details::assign_result<name ## _t, U>::type \
+        operator= (U &&u) const \
+            noexcept(::namedargs::details::is_nothrow_assign<name ## _t, U &&>::value) \
+        { return {static_cast<U &&>(u)}; }\
+        template<typename ...Args> \
+        constexpr ::namedargs::details::piecewise<name ## _t, Args &&...> \
+        emplace(Args && ...args) const noexcept \
+        { return ::namedargs::details::make_piecewise<name ## _t>(static_cast<Args &&>(args)...); }\
+    } const name{};
+
+// the key which can be passed more than once, all the values are collected by
+// the `namedargs::get_all()`, the `get()` returns the first one.
+#define NAMEDARGS_MULTI(name, type_) \
+    struct name ## _t { \
+        using type = type_; \
+        using multi_tag = void; \
+        type v; \
+        template<typename U> \
+        constexpr typename ::namedargs::details::assign_result<name ## _t, U>::type \
+        operator= (U &&u) const \
+            noexcept(::namedargs::details::is_nothrow_assign<name ## _t, U &&>::value) \
+        { return {static_cast<U &&>(u)}; }\
+        template<typename ...Args> \
+        constexpr ::namedargs::details::piecewise<name ## _t, Args &&...> \
+        emplace(Args && ...args) const noexcept \
+        { return ::namedargs::details::make_piecewise<name ## _t>(static_cast<Args &&>(args)...); }\
+    } const name{};
+
+// the allocator of the pack, the values of the allocator-aware keys which are converted
+// from the other type, or are taken from the pack, or are the defaults, are constructed
+// using it, like `std::pmr::string(src, alloc)`.
+#define NAMEDARGS_ALLOC(name, type_) \
+    struct name ## _t { \
+        using type = type_; \
+        using alloc_tag = void; \
+        type v; \
+        name ## _t operator= (type a) const noexcept \
+        { return {a}; }\
+    } const name{};
+
+// the `get()` for output key returns a writable reference to the caller's storage.
+// accepts only the `namedargs::out()` result.
+#define NAMEDARGS_OUT(name, type_) \
+    struct name ## _t { \
+        using type = type_ &; \
+        ::namedargs::details::out_holder<type_> v; \
+        constexpr name ## _t operator= (::namedargs::details::out_holder<type_> o) const noexcept \
+        { return {o}; }\
+    } const name{};
+
+// the boolean switch which is folded into the `flags_type` mask by the `namedargs::get_flags()`.
+// the `bit` must be unique in the group, the `flags()` and `get_flags()` reject the pack
+// of the distinct flags with the same bit. the bit is tested as `f & args.verbose.mask()`.
+// the flags folded by the `flags()` are seen by the `get_flags()` only.
+#define NAMEDARGS_FLAG(name, bit) \
+    struct name ## _t { \
+        static_assert((bit) >= 0 && (bit) < 64, "the bit is out of range!"); \
+        using type = bool; \
+        static constexpr ::namedargs::flags_type mask() noexcept \
+        { return ::namedargs::flags_type{1} << (bit); }\
+        bool v; \
+        constexpr name ## _t operator= (bool b) const noexcept \
+        { return {b}; }\
+    } const name{};
+
+/*************************************************************************************************/
+
+#endif // __NAMED_ARGS__MACROS_HPP_INCLUDED
@@ -0,0 +1,446 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#ifndef __NAMED_ARGS__MEMOIZE_HPP_INCLUDED
+#define __NAMED_ARGS__MEMOIZE_HPP_INCLUDED
+
+#include <named-args/named-args.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace namedargs {
+namespace details {
+
+/*************************************************************************************************/
+// hash
+
+inline std::size_t hash_combine(std::size_t seed, std::size_t h) {
+    return seed ^ (h + static_cast<std::size_t>(0x9e3779b97f4a7c15ull) + (seed << 6) + (seed >> 2));
+}
+
+template<std::size_t I, std::size_t N>
+struct tuple_hash_impl {
+    template<typename Tuple>
+    static std::size_t hash(std::size_t seed, const Tuple &tuple) {
+        using T = typename std::tuple_element<I, Tuple>::type;
+        return tuple_hash_impl<I+1, N>::hash(
+            hash_combine(seed, std::hash<T>{}(std::get<I>(tuple))), tuple);
+    }
+};
+
+template<std::size_t N>
+struct tuple_hash_impl<N, N> {
+    template<typename Tuple>
+    static std::size_t hash(std::size_t seed, const Tuple &) {
+        return seed;
+    }
+};
+
+template<typename Tuple>
+struct tuple_hash {
+    std::size_t operator()(const Tuple &tuple) const {
+        return tuple_hash_impl<0, std::tuple_size<Tuple>::value>::hash(0, tuple);
+    }
+};
+
+/*************************************************************************************************/
+// all of the Args are contained in the Keys
+
+template<typename Keys, typename ...Args>
+struct all_contained;
+
+template<typename ...Keys>
+struct all_contained<types_list<Keys...>>
+    :std::true_type
+{};
+
+template<typename ...Keys, typename Arg0, typename ...Args>
+struct all_contained<types_list<Keys...>, Arg0, Args...>
+    :std::integral_constant<
+         bool
+        ,position<Arg0, Keys...>::value != -1
+            && all_contained<types_list<Keys...>, Args...>::value
+    >
+{};
+
+/*************************************************************************************************/
+// the key with the constructed value
+
+template<typename K>
+typename key_of<K>::type materialize(const K &k) {
+    using key = typename key_of<K>::type;
+    return {static_cast<typename key::type>(k.v)};
+}
+
+} // ns details
+
+/*************************************************************************************************/
+// open-addressing LRU cache with the fixed capacity.
+// the hash of the key is computed by the caller and passed to the `find()` and `insert()`,
+// thus, the sharded cache hashes the key once for both the shard and the slot.
+
+template<typename Key, typename Value>
+class lru_cache {
+    lru_cache(const lru_cache &) = delete;
+    lru_cache& operator= (const lru_cache &) = delete;
+
+    static constexpr std::size_t nil = static_cast<std::size_t>(-1);
+
+    struct entry {
+        Key key;
+        Value value;
+    };
+    struct slot {
+        std::size_t hash;
+        std::size_t prev; // to the more recently used
+        std::size_t next; // to the less recently used
+        bool busy;
+        typename std::aligned_storage<sizeof(entry), alignof(entry)>::type storage;
+
+        entry& get() { return *reinterpret_cast<entry *>(&storage); }
+    };
+
+public:
+    explicit lru_cache(std::size_t capacity)
+        :m_capacity{capacity ? capacity : 1}
+        ,m_size{0}
+        ,m_mask{}
+        ,m_head{nil}
+        ,m_tail{nil}
+        ,m_slots{}
+    {
+        // the load factor is kept at or below 0.5
+        std::size_t n = 2;
+        while ( n < m_capacity * 2 ) {
+            n *= 2;
+        }
+        m_mask = n - 1;
+        m_slots.reset(new slot[n]);
+        for ( std::size_t i = 0; i < n; ++i ) {
+            m_slots[i].busy = false;
+        }
+    }
+    lru_cache(lru_cache &&r)
+        :m_capacity{r.m_capacity}
+        ,m_size{r.m_size}
+        ,m_mask{r.m_mask}
+        ,m_head{r.m_head}
+        ,m_tail{r.m_tail}
+        ,m_slots{std::move(r.m_slots)}
+    {
+        r.m_size = 0;
+        r.m_head = r.m_tail = nil;
+    }
+    ~lru_cache() { if ( m_slots ) { clear(); } }
+
+    std::size_t size() const { return m_size; }
+    std::size_t capacity() const { return m_capacity; }
+
+    // the returned pointer is valid until the next `insert()` or `clear()`
+    const Value* find(std::size_t hash, const Key &key) {
+        for ( std::size_t i = hash & m_mask; m_slots[i].busy; i = (i + 1) & m_mask ) {
+            slot &s = m_slots[i];
+            if ( s.hash == hash && s.get().key == key ) {
+                unlink(i);
+                push_front(i);
+
+                return &s.get().value;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // the key must not be in the cache.
+    // evicts the least recently used entry if the cache is full.
+    const Value& insert(std::size_t hash, Key key, Value value) {
+        if ( m_size == m_capacity ) {
+            erase(m_tail);
+        }
+
+        std::size_t i = hash & m_mask;
+        while ( m_slots[i].busy ) {
+            i = (i + 1) & m_mask;
+        }
+
+        slot &s = m_slots[i];
+        ::new(static_cast<void *>(&s.storage)) entry{std::move(key), std::move(value)};
+        s.hash = hash;
+        s.busy = true;
+        push_front(i);
+        ++m_size;
+
+        return s.get().value;
+    }
+
+    void clear() {
+        for ( std::size_t i = m_head; i != nil; ) {
+            std::size_t next = m_slots[i].next;
+            m_slots[i].get().~entry();
+            m_slots[i].busy = false;
+            i = next;
+        }
+        m_head = m_tail = nil;
+        m_size = 0;
+    }
+
+private:
+    void unlink(std::size_t i) {
+        slot &s = m_slots[i];
+        (s.prev != nil ? m_slots[s.prev].next : m_head) = s.next;
+        (s.next != nil ? m_slots[s.next].prev : m_tail) = s.prev;
+    }
+    void push_front(std::size_t i) {
+        slot &s = m_slots[i];
+        s.prev = nil;
+        s.next = m_head;
+        (m_head != nil ? m_slots[m_head].prev : m_tail) = i;
+        m_head = i;
+    }
+    // moves the entry from the slot `from` to the free slot `to` keeping its LRU position
+    void relocate(std::size_t from, std::size_t to) {
+        slot &src = m_slots[from];
+        slot &dst = m_slots[to];
+        ::new(static_cast<void *>(&dst.storage)) entry(std::move(src.get()));
+        src.get().~entry();
+        src.busy = false;
+
+        dst.hash = src.hash;
+        dst.prev = src.prev;
+        dst.next = src.next;
+        dst.busy = true;
+        (dst.prev != nil ? m_slots[dst.prev].next : m_head) = to;
+        (dst.next != nil ? m_slots[dst.next].prev : m_tail) = to;
+    }
+    // backward-shift deletion, so no tombstones are needed
+    void erase(std::size_t i) {
+        unlink(i);
+        m_slots[i].get().~entry();
+        m_slots[i].busy = false;
+        --m_size;
+
+        for ( std::size_t j = (i + 1) & m_mask; m_slots[j].busy; j = (j + 1) & m_mask ) {
+            std::size_t home = m_slots[j].hash & m_mask;
+            // is the `home` cyclically in (i, j]? then the entry stays in place
+            bool stays = i <= j
+                ? (i < home && home <= j)
+                : (i < home || home <= j)
+            ;
+            if ( !stays ) {
+                relocate(j, i);
+                i = j;
+            }
+        }
+    }
+
+private:
+    std::size_t m_capacity;
+    std::size_t m_size;
+    std::size_t m_mask;
+    std::size_t m_head;
+    std::size_t m_tail;
+    std::unique_ptr<slot[]> m_slots;
+};
+
+template<typename Key, typename Value>
+constexpr std::size_t lru_cache<Key, Value>::nil;
+
+/*************************************************************************************************/
+// memoization
+
+// the Keys are the keys which take part in the cache key, with their default values:
+// `namedargs::memoize(f, 1024, args.fname, args.fmode = 'r')`.
+// the absent key is treated as passed with its default value, and the order of the
+// passed keys doesn't matter. the `f` is always called with the full set of the Keys.
+template<typename F, typename ...Keys>
+class memoized {
+public:
+    using key_type = std::tuple<typename Keys::type...>;
+    using result_type = typename std::decay<
+        decltype(std::declval<F &>()(std::declval<const Keys &>()...))
+    >::type;
+    using hasher = details::tuple_hash<key_type>;
+    using cache_type = lru_cache<key_type, result_type>;
+
+    memoized(F f, std::size_t capacity, const Keys &...keys)
+        :m_func(std::move(f))
+        ,m_keys(keys...)
+        ,m_cache{capacity}
+    {}
+
+    template<typename ...Args>
+    result_type operator()(Args && ...a) {
+        static_assert(
+             details::all_contained<details::types_list<Keys...>, Args...>::value
+            ,"the key which is not a part of the cache key!"
+        );
+
+        key_type key = make_key(m_keys, indexes{}, a...);
+        std::size_t hash = hasher{}(key);
+        if ( const result_type *res = m_cache.find(hash, key) ) {
+            return *res;
+        }
+
+        result_type res = invoke(m_func, m_keys, indexes{}, key);
+        m_cache.insert(hash, std::move(key), res);
+
+        return res;
+    }
+
+    cache_type& cache() { return m_cache; }
+
+private:
+    template<typename, typename ...>
+    friend class sharded_memoized;
+
+    using indexes = typename details::make_index_list<sizeof...(Keys)>::type;
+
+    template<std::size_t ...I, typename ...Args>
+    static key_type make_key(
+         const std::tuple<Keys...> &keys
+        ,details::index_list<I...>
+        ,const Args &...a)
+    {
+        return key_type(
+            namedargs::get(std::get<I>(keys), namedargs::def(std::get<I>(keys)), a...)...
+        );
+    }
+
+    template<std::size_t ...I>
+    static result_type invoke(
+         F &func
+        ,const std::tuple<Keys...> &keys
+        ,details::index_list<I...>
+        ,const key_type &key)
+    {
+        return func((std::get<I>(keys) = std::get<I>(key))...);
+    }
+
+private:
+    F m_func;
+    std::tuple<Keys...> m_keys;
+    cache_type m_cache;
+};
+
+// the same, but for the concurrent callers.
+// the cache is split into the shards each guarded by its own mutex,
+// the `f` is called without any lock held, thus, it must be thread-safe.
+template<typename F, typename ...Keys>
+class sharded_memoized {
+    using memo_type = memoized<F, Keys...>;
+
+public:
+    using key_type = typename memo_type::key_type;
+    using result_type = typename memo_type::result_type;
+    using hasher = typename memo_type::hasher;
+    using cache_type = typename memo_type::cache_type;
+
+    sharded_memoized(F f, std::size_t shards, std::size_t capacity, const Keys &...keys)
+        :m_func(std::move(f))
+        ,m_keys(keys...)
+        ,m_shards{}
+    {
+        shards = shards ? shards : 1;
+        std::size_t per_shard = (capacity + shards - 1) / shards;
+        m_shards.reserve(shards);
+        for ( std::size_t i = 0; i < shards; ++i ) {
+            m_shards.emplace_back(new shard{per_shard});
+        }
+    }
+
+    template<typename ...Args>
+    result_type operator()(Args && ...a) {
+        static_assert(
+             details::all_contained<details::types_list<Keys...>, Args...>::value
+            ,"the key which is not a part of the cache key!"
+        );
+
+        key_type key = memo_type::make_key(m_keys, indexes{}, a...);
+        std::size_t hash = hasher{}(key);
+        // the low bits are used by the cache itself
+        shard &s = *m_shards[(hash >> (sizeof(hash) * 4)) % m_shards.size()];
+        {
+            std::lock_guard<std::mutex> lock{s.mutex};
+            if ( const result_type *res = s.cache.find(hash, key) ) {
+                return *res;
+            }
+        }
+
+        result_type res = memo_type::invoke(m_func, m_keys, indexes{}, key);
+        std::lock_guard<std::mutex> lock{s.mutex};
+        // could be inserted by the concurrent caller
+        if ( !s.cache.find(hash, key) ) {
+            s.cache.insert(hash, std::move(key), res);
+        }
+
+        return res;
+    }
+
+    std::size_t shards() const { return m_shards.size(); }
+
+private:
+    using indexes = typename details::make_index_list<sizeof...(Keys)>::type;
+
+    struct shard {
+        explicit shard(std::size_t capacity)
+            :mutex{}
+            ,cache{capacity}
+        {}
+
+        std::mutex mutex;
+        cache_type cache;
+    };
+
+    F m_func;
+    std::tuple<Keys...> m_keys;
+    std::vector<std::unique_ptr<shard>> m_shards;
+};
+
+/*************************************************************************************************/
+
+template<typename F, typename ...Keys>
+memoized<F, typename details::key_of<Keys>::type...>
+memoize(F f, std::size_t capacity, const Keys &...keys) {
+    return {std::move(f), capacity, details::materialize(keys)...};
+}
+
+template<typename F, typename ...Keys>
+sharded_memoized<F, typename details::key_of<Keys>::type...>
+memoize_sharded(F f, std::size_t shards, std::size_t capacity, const Keys &...keys) {
+    return {std::move(f), shards, capacity, details::materialize(keys)...};
+}
+
+/*************************************************************************************************/
+
+} // ns namedargs
+
+#endif // __NAMED_ARGS__MEMOIZE_HPP_INCLUDED
@@ -0,0 +1,48 @@
+
+// ----------------------------------------------------------------------------
+// MIT License
+//
+// Copyright (c) 2022-2023 niXman (github dot nixman at pm dot me)
+// This file is part of NamedArgs(github.com/niXman/named-args) project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// the C++20 module interface unit, it's built from the same sources as the `named-args.hpp`.
+// usage: `import named_args;` followed by the `#include <named-args/macros.hpp>`.
+// with GCC, the textual includes of the standard headers must precede the `import`.
+
+module;
+
+// the standard headers of the `named-args.hpp`, in the global module fragment
+#include <type_traits>
+#include <tuple>
+// GCC 12 crashes (ICE in `make_decl_rtl`, at `bits/allocator.h`) compiling the importer which
+// includes the `<string>`, when the `<memory>` is in the global module fragment.
+// the libstdc++ declares std::uses_allocator and std::allocator_arg in the `<tuple>`
+#if !defined(__GNUC__) || defined(__clang__) || __GNUC__ >= 13
+#   include <memory>
+#endif
+#include <array>
+#include <cstdint>
+
+export module named_args;
+
+#define NAMEDARGS_EXPORT export
+#include <named-args/named-args.hpp>
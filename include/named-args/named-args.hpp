@@ -27,15 +27,41 @@
 #ifndef __NAMED_ARGS__NAMED_ARGS_HPP_INCLUDED
 #define __NAMED_ARGS__NAMED_ARGS_HPP_INCLUDED
 
-#include <type_traits>
-#include <tuple>
+// the module interface unit includes them in its global module fragment
+#ifndef NAMEDARGS_EXPORT
+#   include <type_traits>
+#   include <tuple>
+#   include <memory> // std::uses_allocator, std::allocator_arg
+#   include <array>
+#   include <cstdint>
+#endif // NAMEDARGS_EXPORT
+
+// when non-zero, the `get()` rejects at compile time the single-valued key which is passed
+// more than once, otherwise the first occurrence is used.
+#ifndef NAMEDARGS_REJECT_DUPLICATES
+#   define NAMEDARGS_REJECT_DUPLICATES 0
+#endif
+
+// `export` when the header is included by the module interface unit
+#ifndef NAMEDARGS_EXPORT
+#   define NAMEDARGS_EXPORT
+#endif
+
+NAMEDARGS_EXPORT namespace namedargs {
+
+// the mask of the flag keys
+using flags_type = std::uint64_t;
 
-namespace namedargs {
 namespace details {
 
 /*************************************************************************************************/
 // tools
 
+template<bool OK, typename T>
+struct enable_ret_holder
+    :std::enable_if<OK, T>
+{};
+
 template<bool OK, typename T>
 struct required_ret_holder {
     static_assert(OK, "no REQUIRED argument!");
@@ -86,6 +112,86 @@ struct disable_if_tuple
     :std::enable_if<is_tuple<T...>::value == false, Ret>
 {};
 
+/*************************************************************************************************/
+// output holder
+
+// refers to the caller's storage. the value of an output key.
+template<typename T>
+struct out_holder {
+    T *ptr;
+
+    constexpr operator T& () const noexcept { return *ptr; }
+};
+
+/*************************************************************************************************/
+// deferred value
+
+template<typename T>
+struct to_void {
+    using type = void;
+};
+
+// the value which is converted to the `K::type` by the `get()` only, thus, the value
+// is not constructed if it's unused default, and it's constructed just once otherwise.
+// used for the cheap to copy sources of the expensive to construct values,
+// like the `args.fname = argv[1]` for the `std::string` key.
+// the `v` is the source itself, so the pack which holds it must not outlive the source
+// it points to. `args.fname = std::string{buf}` stores the value of the key type instead.
+template<typename K, typename S>
+struct deferred {
+    using key_type = K;
+    using type = typename K::type;
+    S v;
+};
+
+// the key of the pack element
+template<typename T, typename = void>
+struct key_of {
+    using type = T;
+};
+
+template<typename T>
+struct key_of<T, typename to_void<typename T::key_type>::type> {
+    using type = typename T::key_type;
+};
+
+template<typename K, typename U, typename S = typename std::decay<U>::type>
+struct should_defer
+    :std::integral_constant<
+         bool
+        ,!std::is_same<S, typename K::type>::value
+            && !std::is_trivially_copyable<typename K::type>::value
+            && std::is_trivially_copyable<S>::value
+            && std::is_convertible<S, typename K::type>::value
+    >
+{};
+
+// the result of the `operator=` of the key K
+template<typename K, typename U>
+struct assign_result {
+    using type = typename std::conditional<
+         should_defer<K, U>::value
+        ,deferred<K, typename std::decay<U>::type>
+        ,K
+    >::type;
+};
+
+// the default value of the key, the result of the `namedargs::def()`.
+// refers to the element, which is the temporary living until the end of the `get()` call.
+template<typename T>
+struct def_holder {
+    T &&elem;
+};
+
+// the `Def` is the default value for the key K
+template<typename K, typename Def>
+struct default_of
+    :std::enable_if<
+         std::is_same<K, typename key_of<typename std::decay<Def>::type>::type>::value
+        ,typename K::type
+    >
+{};
+
 /*************************************************************************************************/
 // position
 
@@ -101,23 +207,28 @@ template<typename T, int I, typename Arg0, typename ...Args>
 struct position_impl<T, I, Arg0, Args...>
     :std::integral_constant<
          int
-        ,std::is_same<T, Arg0>::value
+        ,std::is_same<T, typename key_of<typename std::decay<Arg0>::type>::type>::value
             ? I
             : position_impl<T, I+1, Args...>::value
     >
 {};
 
 template<typename T, typename ...Args>
-struct position;
+struct position_decayed
+    :position_impl<T, 0, Args...>
+{};
 
 template<typename T, typename ...Args>
-struct position
-    :position_impl<typename std::decay<T>::type, 0, Args...>
+struct position_decayed<T, std::tuple<Args...>>
+    :position_impl<T, 0, Args...>
 {};
 
 template<typename T, typename ...Args>
-struct position<T, std::tuple<Args...>>
-    :position_impl<typename std::decay<T>::type, 0, Args...>
+struct position
+    :position_decayed<
+         typename key_of<typename std::decay<T>::type>::type
+        ,typename std::decay<Args>::type...
+    >
 {};
 
 /*************************************************************************************************/
@@ -177,6 +288,66 @@ struct multi_contains<types_list<T0, Types...>, Args...>
     >::type
 {};
 
+/*************************************************************************************************/
+// noexcept
+
+// the construction of the value for the key K from the `U`
+template<typename K, typename U, typename R = typename assign_result<K, U>::type>
+struct is_nothrow_assign
+    :std::integral_constant<
+         bool
+        ,std::is_nothrow_constructible<decltype(std::declval<R>().v), U>::value
+            && std::is_nothrow_move_constructible<R>::value
+    >
+{};
+
+// the construction of the value of type T from the `v` member of the `Arg`
+template<typename T, typename Arg>
+struct is_nothrow_fetch
+    :std::is_nothrow_constructible<T, decltype((std::declval<Arg>().v))>
+{};
+
+// the `v` member of the I-th element of the tuple is casted to this type
+// by the `get()` with default value. the element which is the rvalue, like the one
+// of the rvalue view, is moved.
+template<typename Tuple, std::size_t I>
+struct tuple_value_cast {
+    using elem = typename tuple_element<I, typename std::decay<Tuple>::type>::type;
+    using value = decltype(std::declval<typename std::decay<elem>::type>().v);
+    using access = decltype((std::get<I>(std::declval<Tuple>()).v));
+    using type = typename std::conditional<
+         !std::is_rvalue_reference<access>::value
+            && (std::is_copy_assignable<value>::value || std::is_copy_assignable<value>::value)
+        ,const value &
+        ,value &&
+    >::type;
+};
+
+template<typename K, typename Def, typename Tuple, int I>
+struct is_nothrow_get_tuple
+    :std::is_nothrow_constructible<typename K::type, typename tuple_value_cast<Tuple, I>::type>
+{};
+
+template<typename K, typename Def, typename Tuple>
+struct is_nothrow_get_tuple<K, Def, Tuple, -1>
+    :is_nothrow_fetch<typename K::type, Def>
+{};
+
+template<typename K, typename Def, int I, typename ...Args>
+struct is_nothrow_get_variadic_impl
+    :is_nothrow_fetch<typename K::type, typename tuple_element<I, Args...>::type>
+{};
+
+template<typename K, typename Def, typename ...Args>
+struct is_nothrow_get_variadic_impl<K, Def, -1, Args...>
+    :is_nothrow_fetch<typename K::type, Def>
+{};
+
+template<typename K, typename Def, typename ...Args>
+struct is_nothrow_get_variadic
+    :is_nothrow_get_variadic_impl<K, Def, position<K, Args...>::value, Args...>
+{};
+
 /*************************************************************************************************/
 // get() for tuple
 
@@ -190,7 +361,12 @@ struct get_arg_impl_tuple<true> {
         ,typename Tuple
         ,std::size_t I
     >
-    static typename K::type get(const K &, int_const<std::size_t, I>, Tuple &&tuple) {
+    static constexpr typename K::type get(const K &, int_const<std::size_t, I>, Tuple &&tuple)
+        noexcept(is_nothrow_fetch<
+             typename K::type
+            ,decltype(std::get<I>(std::declval<Tuple>()))
+        >::value)
+    {
         return std::get<I>(std::forward<Tuple>(tuple)).v;
     }
     template<
@@ -199,14 +375,11 @@ struct get_arg_impl_tuple<true> {
         ,typename Tuple
         ,std::size_t I
     >
-    static typename K::type get(const K &, Def &&, int_const<std::size_t, I>, Tuple &&tuple) {
-        using Elem = typename tuple_element<I, typename std::decay<Tuple>::type>::type;
-        using T = typename Elem::type;
-        using cast_to = typename std::conditional<
-             std::is_copy_assignable<T>::value || std::is_copy_assignable<T>::value
-            ,const T &
-            ,T &&
-        >::type;
+    static constexpr typename K::type
+    get(const K &, Def &&, int_const<std::size_t, I>, Tuple &&tuple)
+        noexcept(is_nothrow_get_tuple<K, Def, Tuple, I>::value)
+    {
+        using cast_to = typename tuple_value_cast<Tuple, I>::type;
         return static_cast<cast_to>(std::get<I>(std::forward<Tuple>(tuple)).v);
     }
 };
@@ -219,8 +392,11 @@ struct get_arg_impl_tuple<false> {
         ,typename Tuple
         ,std::size_t I
     >
-    static typename K::type get(const K &, Def &&def, int_const<std::size_t, I>, Tuple &&/*tuple*/) {
-        return std::forward<typename Def::type>(std::forward<Def>(def).v);
+    static constexpr typename K::type
+    get(const K &, Def &&def, int_const<std::size_t, I>, Tuple &&/*tuple*/)
+        noexcept(is_nothrow_fetch<typename K::type, Def>::value)
+    {
+        return std::forward<Def>(def).v;
     }
 };
 
@@ -238,9 +414,17 @@ struct get_arg_impl_variadic<true> {
         ,typename Arg0
         ,typename ...Args
     >
-    static typename std::enable_if<!std::is_same<K, Arg0>::value, typename K::type>::type
-    get(const K &unused0, Def &&unused1, Arg0 &&/*arg0*/, Args && ...args) {
-        return get(unused0, std::forward<Def>(unused1), std::forward<Args>(args)...);
+    static constexpr typename std::enable_if<
+         !std::is_same<
+             typename key_of<K>::type
+            ,typename key_of<typename std::decay<Arg0>::type>::type
+         >::value
+        ,typename K::type
+    >::type
+    get(const K &unused0, Def &&unused1, Arg0 &&/*arg0*/, Args && ...args)
+        noexcept(is_nothrow_get_variadic<K, Def, Arg0, Args...>::value)
+    {
+        return get(unused0, static_cast<Def &&>(unused1), static_cast<Args &&>(args)...);
     }
     template<
          typename K
@@ -248,9 +432,17 @@ struct get_arg_impl_variadic<true> {
         ,typename Arg0
         ,typename ...Args
     >
-    static typename std::enable_if<std::is_same<K, Arg0>::value, typename K::type>::type
-    get(const K &/*unused0*/, Def &&/*unused1*/, Arg0 &&arg0, Args && .../*args*/) {
-        return std::forward<Arg0>(arg0).v;
+    static constexpr typename std::enable_if<
+         std::is_same<
+             typename key_of<K>::type
+            ,typename key_of<typename std::decay<Arg0>::type>::type
+         >::value
+        ,typename K::type
+    >::type
+    get(const K &/*unused0*/, Def &&/*unused1*/, Arg0 &&arg0, Args && .../*args*/)
+        noexcept(is_nothrow_fetch<typename K::type, Arg0>::value)
+    {
+        return static_cast<Arg0 &&>(arg0).v;
     }
 };
 
@@ -261,15 +453,685 @@ struct get_arg_impl_variadic<false> {
         ,typename Def
         ,typename ...Args
     >
-    static typename Def::type get(const K &/*k*/, Def &&def, Args &&.../*args*/) {
-        return std::forward<Def>(def).v;
+    static constexpr typename K::type get(const K &/*k*/, Def &&def, Args &&.../*args*/)
+        noexcept(is_nothrow_fetch<typename K::type, Def>::value)
+    {
+        return static_cast<Def &&>(def).v;
+    }
+};
+
+/*************************************************************************************************/
+// views
+
+template<std::size_t ...I>
+struct index_list {};
+
+template<std::size_t N, std::size_t ...I>
+struct make_index_list
+    :make_index_list<N-1, N-1, I...>
+{};
+
+template<std::size_t ...I>
+struct make_index_list<0, I...> {
+    using type = index_list<I...>;
+};
+
+// indexes of the Args which are contained (or, if Except, NOT contained) in the Keys
+template<bool Except, typename Keys, typename Indexes, std::size_t I, typename ...Args>
+struct select_indexes;
+
+template<bool Except, typename Keys, std::size_t ...Is, std::size_t I>
+struct select_indexes<Except, Keys, index_list<Is...>, I> {
+    using type = index_list<Is...>;
+};
+
+template<
+     bool Except
+    ,typename ...Keys
+    ,std::size_t ...Is
+    ,std::size_t I
+    ,typename Arg0
+    ,typename ...Args
+>
+struct select_indexes<Except, types_list<Keys...>, index_list<Is...>, I, Arg0, Args...>
+    :select_indexes<
+         Except
+        ,types_list<Keys...>
+        ,typename std::conditional<
+             (position<Arg0, Keys...>::value != -1) != Except
+            ,index_list<Is..., I>
+            ,index_list<Is...>
+         >::type
+        ,I+1
+        ,Args...
+    >
+{};
+
+template<bool Except, typename Keys, typename Tuple>
+struct select_tuple_indexes;
+
+template<bool Except, typename Keys, typename ...Args>
+struct select_tuple_indexes<Except, Keys, std::tuple<Args...>>
+    :select_indexes<Except, Keys, index_list<>, 0, Args...>
+{};
+
+// the pack which was forwarded as a single tuple: `std::forward_as_tuple(a...)`
+// where `a` is the view
+template<typename Tuple>
+struct is_nested_pack
+    :std::false_type
+{};
+
+template<typename T>
+struct is_nested_pack<std::tuple<T>>
+    :is_tuple<typename std::decay<T>::type>
+{};
+
+template<typename Tuple, bool = is_nested_pack<typename std::decay<Tuple>::type>::value>
+struct unwrap_pack {
+    using type = Tuple;
+    static Tuple&& get(Tuple &&tuple) noexcept { return static_cast<Tuple &&>(tuple); }
+};
+
+template<typename Tuple>
+struct unwrap_pack<Tuple, true> {
+    using type = decltype(std::get<0>(std::declval<Tuple>()));
+    static type get(Tuple &&tuple) noexcept { return std::get<0>(static_cast<Tuple &&>(tuple)); }
+};
+
+// the elements of the view are the references of the same value category as the
+// elements of the pack: the rvalue pack gives the rvalue references, so they can be moved
+template<typename Tuple, typename Indexes>
+struct view_maker;
+
+template<typename Tuple, std::size_t ...I>
+struct view_maker<Tuple, index_list<I...>> {
+    using type = std::tuple<decltype(std::get<I>(std::declval<Tuple>()))...>;
+    static type make(Tuple &&tuple) noexcept {
+        return type(std::get<I>(static_cast<Tuple &&>(tuple))...);
+    }
+};
+
+template<bool Except, typename Tuple, typename ...Keys>
+struct view_of {
+    using pack = unwrap_pack<Tuple>;
+    using indexes = typename select_tuple_indexes<
+         Except
+        ,types_list<Keys...>
+        ,typename std::decay<typename pack::type>::type
+    >::type;
+    using maker = view_maker<typename pack::type, indexes>;
+    using type = typename maker::type;
+
+    static type make(Tuple &&tuple) noexcept {
+        return maker::make(pack::get(static_cast<Tuple &&>(tuple)));
+    }
+};
+
+/*************************************************************************************************/
+// piecewise
+
+// the constructor args of the T, which is constructed by the conversion, thus, it's
+// constructed once, right in the place where it's fetched by the `get()`.
+// the args are the references to the caller's values. they are passed as the lvalues
+// when the `ctor_args` is the lvalue, so the key can be fetched more than once,
+// and are forwarded as they were passed to the `emplace()` only from the rvalue,
+// like the one from `get(k, std::forward<Args>(a)...)`.
+template<typename T, typename ...Args>
+struct ctor_args {
+    std::tuple<Args...> args;
+
+    template<std::size_t ...I>
+    constexpr T make(index_list<I...>, std::false_type) const
+        noexcept(std::is_nothrow_constructible<T, Args &...>::value)
+    {
+        return T(std::get<I>(args)...);
+    }
+    template<std::size_t ...I>
+    constexpr T make(index_list<I...>, std::true_type) const
+        noexcept(std::is_nothrow_constructible<T, Args...>::value)
+    {
+        return T(static_cast<Args>(std::get<I>(args))...);
+    }
+
+    constexpr operator T() const & noexcept(std::is_nothrow_constructible<T, Args &...>::value) {
+        return make(typename make_index_list<sizeof...(Args)>::type{}, std::false_type{});
+    }
+    constexpr operator T() const && noexcept(std::is_nothrow_constructible<T, Args...>::value) {
+        return make(typename make_index_list<sizeof...(Args)>::type{}, std::true_type{});
+    }
+};
+
+// the result of the `args.buf.emplace(a, b, c)`
+template<typename K, typename ...Args>
+struct piecewise {
+    using key_type = K;
+    using type = typename K::type;
+    ctor_args<type, Args...> v;
+};
+
+template<typename K, typename ...Args>
+constexpr piecewise<K, Args &&...> make_piecewise(Args && ...args) noexcept {
+    return {{std::tuple<Args &&...>(static_cast<Args &&>(args)...)}};
+}
+
+/*************************************************************************************************/
+// flags
+
+// the result of the `namedargs::flags()`
+struct flag_set {
+    flags_type assigned;
+    flags_type bits;
+};
+
+template<typename T, typename = void>
+struct is_flag
+    :std::false_type
+{};
+
+template<typename T>
+struct is_flag<T, typename to_void<decltype(T::mask())>::type>
+    :std::true_type
+{};
+
+template<typename T>
+constexpr typename std::enable_if<is_flag<T>::value, flags_type>::type
+flag_bits(const T &f) noexcept {
+    return f.v ? T::mask() : 0;
+}
+
+template<typename T>
+constexpr typename std::enable_if<is_flag<T>::value, flags_type>::type
+flag_assigned(const T &) noexcept {
+    return T::mask();
+}
+
+// the helpers are templates, so they are instantiated by the importers of the module:
+// GCC 12 doesn't emit the non-template constexpr functions into the module object
+template<typename T>
+constexpr typename std::enable_if<std::is_same<T, flag_set>::value, flags_type>::type
+flag_bits(const T &s) noexcept {
+    return s.bits;
+}
+
+template<typename T>
+constexpr typename std::enable_if<std::is_same<T, flag_set>::value, flags_type>::type
+flag_assigned(const T &s) noexcept {
+    return s.assigned;
+}
+
+// all other args are skipped
+template<typename T>
+constexpr typename std::enable_if<
+     !is_flag<T>::value && !std::is_same<T, flag_set>::value
+    ,flags_type
+>::type
+flag_bits(const T &) noexcept {
+    return 0;
+}
+
+template<typename T>
+constexpr typename std::enable_if<
+     !is_flag<T>::value && !std::is_same<T, flag_set>::value
+    ,flags_type
+>::type
+flag_assigned(const T &) noexcept {
+    return 0;
+}
+
+template<typename = void>
+constexpr flags_type all_flag_bits() noexcept {
+    return 0;
+}
+
+// the flag passed more than once is taken by its first occurrence, as by the `get()`
+template<typename Arg0, typename ...Args>
+constexpr flags_type all_flag_bits(const Arg0 &arg0, const Args &...args) noexcept {
+    return flag_bits(arg0) | (all_flag_bits(args...) & ~flag_assigned(arg0));
+}
+
+template<typename = void>
+constexpr flags_type all_flag_assigned() noexcept {
+    return 0;
+}
+
+template<typename Arg0, typename ...Args>
+constexpr flags_type all_flag_assigned(const Arg0 &arg0, const Args &...args) noexcept {
+    return flag_assigned(arg0) | all_flag_assigned(args...);
+}
+
+template<typename Tuple, std::size_t ...I>
+constexpr flags_type tuple_flag_bits(const Tuple &tuple, index_list<I...>) noexcept {
+    return all_flag_bits(std::get<I>(tuple)...);
+}
+
+template<typename Tuple, std::size_t ...I>
+constexpr flags_type tuple_flag_assigned(const Tuple &tuple, index_list<I...>) noexcept {
+    return all_flag_assigned(std::get<I>(tuple)...);
+}
+
+// the mask of the flag key, zero for the other args
+template<typename T, bool = is_flag<T>::value>
+struct mask_of
+    :std::integral_constant<flags_type, 0>
+{};
+
+template<typename T>
+struct mask_of<T, true>
+    :std::integral_constant<flags_type, T::mask()>
+{};
+
+// the flag key T shares a bit with the other flag key of the Args
+template<typename T, typename ...Args>
+struct overlaps_any;
+
+template<typename T>
+struct overlaps_any<T>
+    :std::false_type
+{};
+
+template<typename T, typename Arg0, typename ...Args>
+struct overlaps_any<T, Arg0, Args...>
+    :std::integral_constant<
+         bool
+        ,(!std::is_same<T, Arg0>::value && (mask_of<T>::value & mask_of<Arg0>::value) != 0)
+            || overlaps_any<T, Args...>::value
+    >
+{};
+
+template<typename ...Args>
+struct masks_overlap_impl;
+
+template<>
+struct masks_overlap_impl<>
+    :std::false_type
+{};
+
+template<typename Arg0, typename ...Args>
+struct masks_overlap_impl<Arg0, Args...>
+    :std::integral_constant<
+         bool
+        ,overlaps_any<Arg0, Args...>::value || masks_overlap_impl<Args...>::value
+    >
+{};
+
+template<typename ...Args>
+struct masks_overlap_decayed
+    :masks_overlap_impl<Args...>
+{};
+
+template<typename ...Args>
+struct masks_overlap_decayed<std::tuple<Args...>>
+    :masks_overlap_impl<typename std::decay<Args>::type...>
+{};
+
+// the distinct flag keys of the pack are bound to the same bit
+template<typename ...Args>
+struct masks_overlap
+    :masks_overlap_decayed<typename std::decay<Args>::type...>
+{};
+
+// the pack contains the result of the `namedargs::flags()`
+template<typename ...Args>
+struct has_flag_set
+    :std::integral_constant<
+         bool
+        ,position_decayed<flag_set, typename std::decay<Args>::type...>::value != -1
+    >
+{};
+
+template<typename ...Args>
+struct has_flag_set<std::tuple<Args...>>
+    :has_flag_set<Args...>
+{};
+
+// the flag key K is looked up by the `get()` in the pack where the flags can be folded
+template<typename K, typename ...Args>
+struct is_folded_flag
+    :std::integral_constant<
+         bool
+        ,is_flag<typename key_of<typename std::decay<K>::type>::type>::value
+            && has_flag_set<Args...>::value
+    >
+{};
+
+template<typename ...Args>
+struct all_flags;
+
+template<>
+struct all_flags<>
+    :std::true_type
+{};
+
+template<typename Arg0, typename ...Args>
+struct all_flags<Arg0, Args...>
+    :std::integral_constant<
+         bool
+        ,is_flag<Arg0>::value && all_flags<Args...>::value
+    >
+{};
+
+/*************************************************************************************************/
+// multi-valued keys
+
+// the key declared by the `NAMEDARGS_MULTI()`
+template<typename T, typename = void>
+struct is_multi
+    :std::false_type
+{};
+
+template<typename T>
+struct is_multi<T, typename to_void<typename T::multi_tag>::type>
+    :std::true_type
+{};
+
+// the number of occurrences of the key T in the Args
+template<typename T, typename ...Args>
+struct count_impl;
+
+template<typename T>
+struct count_impl<T>
+    :std::integral_constant<std::size_t, 0>
+{};
+
+template<typename T, typename Arg0, typename ...Args>
+struct count_impl<T, Arg0, Args...>
+    :std::integral_constant<
+         std::size_t
+        ,std::is_same<T, typename key_of<typename std::decay<Arg0>::type>::type>::value
+            + count_impl<T, Args...>::value
+    >
+{};
+
+template<typename T, typename ...Args>
+struct count_decayed
+    :count_impl<T, Args...>
+{};
+
+template<typename T, typename ...Args>
+struct count_decayed<T, std::tuple<Args...>>
+    :count_impl<T, Args...>
+{};
+
+template<typename T, typename ...Args>
+struct count_of
+    :count_decayed<
+         typename key_of<typename std::decay<T>::type>::type
+        ,typename std::decay<Args>::type...
+    >
+{};
+
+// the single-valued key which is passed more than once while it's rejected
+template<typename K, typename ...Args>
+struct is_duplicated
+    :std::integral_constant<
+         bool
+        ,NAMEDARGS_REJECT_DUPLICATES != 0
+            && !is_multi<typename key_of<typename std::decay<K>::type>::type>::value
+            && (count_of<K, Args...>::value > 1)
+    >
+{};
+
+// the flag key which is passed more than once while the duplicates are rejected.
+// the flags folded by the `namedargs::flags()` are not seen
+template<typename ...Args>
+struct flag_duplicated_impl;
+
+template<>
+struct flag_duplicated_impl<>
+    :std::false_type
+{};
+
+template<typename Arg0, typename ...Args>
+struct flag_duplicated_impl<Arg0, Args...>
+    :std::integral_constant<
+         bool
+        ,(is_flag<Arg0>::value && count_impl<Arg0, Args...>::value != 0)
+            || flag_duplicated_impl<Args...>::value
+    >
+{};
+
+template<typename ...Args>
+struct flag_duplicated_decayed
+    :flag_duplicated_impl<Args...>
+{};
+
+template<typename ...Args>
+struct flag_duplicated_decayed<std::tuple<Args...>>
+    :flag_duplicated_impl<typename std::decay<Args>::type...>
+{};
+
+template<typename ...Args>
+struct is_flag_duplicated
+    :std::integral_constant<
+         bool
+        ,NAMEDARGS_REJECT_DUPLICATES != 0
+            && flag_duplicated_decayed<typename std::decay<Args>::type...>::value
+    >
+{};
+
+// the I-th of the args
+template<std::size_t I>
+struct arg_at {
+    template<typename Arg0, typename ...Args>
+    static constexpr typename tuple_element<I, Arg0 &&, Args &&...>::type
+    get(Arg0 &&/*arg0*/, Args && ...args) noexcept {
+        return arg_at<I-1>::get(static_cast<Args &&>(args)...);
     }
 };
 
+template<>
+struct arg_at<0> {
+    template<typename Arg0, typename ...Args>
+    static constexpr Arg0 && get(Arg0 &&arg0, Args && .../*args*/) noexcept {
+        return static_cast<Arg0 &&>(arg0);
+    }
+};
+
+// the values of the elements with the specified indexes, collected into `std::array`
+template<typename K, typename Indexes>
+struct collect;
+
+template<typename K, std::size_t ...I>
+struct collect<K, index_list<I...>> {
+    using type = std::array<typename K::type, sizeof...(I)>;
+
+    template<typename ...Args>
+    static constexpr type from_args(Args && ...args) {
+        return type{{
+            static_cast<typename K::type>(arg_at<I>::get(static_cast<Args &&>(args)...).v)...
+        }};
+    }
+    template<typename Tuple>
+    static constexpr type from_tuple(Tuple &&tuple) {
+        return type{{
+            static_cast<typename K::type>(std::get<I>(std::forward<Tuple>(tuple)).v)...
+        }};
+    }
+};
+
+template<typename K, typename ...Args>
+struct collect_args
+    :collect<K, typename select_indexes<false, types_list<K>, index_list<>, 0, Args...>::type>
+{};
+
+// it's not a tuple
+template<typename K, typename Tuple>
+struct collect_tuple
+{};
+
+template<typename K, typename ...Args>
+struct collect_tuple<K, std::tuple<Args...>>
+    :collect<K, typename select_indexes<false, types_list<K>, index_list<>, 0, Args...>::type>
+{};
+
+/*************************************************************************************************/
+// allocator
+
+// the key declared by the `NAMEDARGS_ALLOC()`
+template<typename T, typename = void>
+struct is_alloc_key
+    :std::false_type
+{};
+
+template<typename T>
+struct is_alloc_key<T, typename to_void<typename T::alloc_tag>::type>
+    :std::true_type
+{};
+
+// the position of the allocator key in the Args
+template<int I, typename ...Args>
+struct alloc_position_impl;
+
+template<int I>
+struct alloc_position_impl<I>
+    :std::integral_constant<int, -1>
+{};
+
+template<int I, typename Arg0, typename ...Args>
+struct alloc_position_impl<I, Arg0, Args...>
+    :std::integral_constant<
+         int
+        ,is_alloc_key<typename std::decay<Arg0>::type>::value
+            ? I
+            : alloc_position_impl<I+1, Args...>::value
+    >
+{};
+
+template<typename ...Args>
+struct alloc_position_decayed
+    :alloc_position_impl<0, Args...>
+{};
+
+template<typename ...Args>
+struct alloc_position_decayed<std::tuple<Args...>>
+    :alloc_position_impl<0, Args...>
+{};
+
+template<typename ...Args>
+struct alloc_position
+    :alloc_position_decayed<typename std::decay<Args>::type...>
+{};
+
+// the allocator type of the pack, or `void`
+template<int A, typename ...Args>
+struct pack_alloc {
+    using type = typename std::decay<typename tuple_element<A, Args...>::type>::type::type;
+};
+
+template<typename ...Args>
+struct pack_alloc<-1, Args...> {
+    using type = void;
+};
+
+// the value of the key K is constructed using the allocator of the pack
+template<typename K, typename ...Args>
+struct use_alloc
+    :std::uses_allocator<
+         typename K::type
+        ,typename pack_alloc<
+             alloc_position<Args...>::value
+            ,typename std::decay<Args>::type...
+         >::type
+    >
+{};
+
+// the uses-allocator construction of the T from the `src`
+template<typename T, typename A, typename S>
+typename std::enable_if<std::is_constructible<T, S, const A &>::value, T>::type
+construct_with(const A &alloc, S &&src) {
+    return T(static_cast<S &&>(src), alloc);
+}
+
+template<typename T, typename A, typename S>
+typename std::enable_if<
+     !std::is_constructible<T, S, const A &>::value
+        && std::is_constructible<T, std::allocator_arg_t, const A &, S>::value
+    ,T
+>::type
+construct_with(const A &alloc, S &&src) {
+    return T(std::allocator_arg, alloc, static_cast<S &&>(src));
+}
+
+// the get() for the pack with the allocator key at the A position
+template<int I, int A>
+struct get_arg_impl_alloc_variadic {
+    template<typename K, typename Def, typename ...Args>
+    static typename K::type get(const K &, Def &&, Args && ...args) {
+        return construct_with<typename K::type>(
+             arg_at<A>::get(args...).v
+            ,arg_at<I>::get(static_cast<Args &&>(args)...).v
+        );
+    }
+};
+
+template<int A>
+struct get_arg_impl_alloc_variadic<-1, A> {
+    template<typename K, typename Def, typename ...Args>
+    static typename K::type get(const K &, Def &&def, Args && ...args) {
+        return construct_with<typename K::type>(arg_at<A>::get(args...).v, static_cast<Def &&>(def).v);
+    }
+};
+
+template<int I, int A>
+struct get_arg_impl_alloc_tuple {
+    template<typename K, typename Tuple, std::size_t J>
+    static typename K::type get(const K &, int_const<std::size_t, J>, Tuple &&tuple) {
+        return construct_with<typename K::type>(
+             std::get<A>(tuple).v
+            ,std::get<I>(std::forward<Tuple>(tuple)).v
+        );
+    }
+    template<typename K, typename Def, typename Tuple, std::size_t J>
+    static typename K::type get(const K &k, Def &&, int_const<std::size_t, J> j, Tuple &&tuple) {
+        return get(k, j, std::forward<Tuple>(tuple));
+    }
+};
+
+template<int A>
+struct get_arg_impl_alloc_tuple<-1, A> {
+    template<typename K, typename Def, typename Tuple, std::size_t J>
+    static typename K::type get(const K &, Def &&def, int_const<std::size_t, J>, Tuple &&tuple) {
+        return construct_with<typename K::type>(std::get<A>(tuple).v, std::forward<Def>(def).v);
+    }
+};
+
+// the implementation of the `get()` for the pack
+template<typename K, typename ...Args>
+struct get_impl_variadic {
+    using type = typename std::conditional<
+         use_alloc<K, Args...>::value
+        ,get_arg_impl_alloc_variadic<position<K, Args...>::value, alloc_position<Args...>::value>
+        ,get_arg_impl_variadic<position<K, Args...>::value != -1>
+    >::type;
+};
+
+template<typename K, typename Tuple>
+struct get_impl_tuple {
+    using type = typename std::conditional<
+         use_alloc<K, Tuple>::value
+        ,get_arg_impl_alloc_tuple<position<K, Tuple>::value, alloc_position<Tuple>::value>
+        ,get_arg_impl_tuple<position<K, Tuple>::value != -1>
+    >::type;
+};
+
 /*************************************************************************************************/
 
 } // ns details
 
+/*************************************************************************************************/
+// for default values
+
+// marks the default value of the key for the `get()`:
+// `namedargs::get(args.fmode, namedargs::def(args.fmode = 'r'), a...)`.
+// the mark is optional, but the unmarked default has the same type as the element of the same
+// key at the beginning of the pack: the `get(k, a...)` for the pack which starts with the `k`
+// takes that element as the default. the marked default is never confused with it.
+template<typename T>
+constexpr details::def_holder<T> def(T &&elem) noexcept {
+    return {static_cast<T &&>(elem)};
+}
+
 /*************************************************************************************************/
 // for tuple
 
@@ -277,90 +1139,232 @@ template<
      typename K
     ,typename Tuple
     ,typename UCT = typename std::decay<Tuple>::type
+    ,int Idx = details::position<K, UCT>::value
 >
-typename details::enable_if_tuple<typename K::type, UCT>::type
-get(const K &k, Tuple &&tuple) {
-    constexpr int idx = details::position<K, UCT>::value;
-    static_assert(idx != -1, "that argument seems to be necessary!");
-    return details::get_arg_impl_tuple<idx != -1>::template get(
-        k, details::int_const<std::size_t, idx>{}, std::forward<Tuple>(tuple));
+constexpr typename details::enable_if_tuple<typename K::type, UCT>::type
+get(const K &k, Tuple &&tuple)
+    noexcept(noexcept(details::get_impl_tuple<K, UCT>::type::get(
+        k, details::int_const<std::size_t, Idx>{}, std::forward<Tuple>(tuple))))
+{
+    static_assert(Idx != -1, "that argument seems to be necessary!");
+    static_assert(!details::is_duplicated<K, UCT>::value, "that argument is passed more than once!");
+    static_assert(!details::is_folded_flag<K, UCT>::value
+        ,"the flags folded by the namedargs::flags() are read by the get_flags() only!");
+    return details::get_impl_tuple<K, UCT>::type::get(
+        k, details::int_const<std::size_t, Idx>{}, std::forward<Tuple>(tuple));
 }
 
+// the tuple is the single arg, so the default doesn't need to be marked by the `def()`
 template<
      typename K
     ,typename Def
     ,typename Tuple
     ,typename UCT = typename std::decay<Tuple>::type
+    ,int Idx = details::position<K, UCT>::value
 >
-typename details::enable_if_tuple<typename K::type, UCT>::type
-get(const K &k, Def &&def, Tuple &&tuple) {
-    constexpr int idx = details::position<K, UCT>::value;
-    return details::get_arg_impl_tuple<idx != -1>::template get(
-        k, std::forward<Def>(def), details::int_const<std::size_t, idx>{}
+constexpr typename details::enable_if_tuple<typename details::default_of<K, Def>::type, UCT>::type
+get(const K &k, Def &&def, Tuple &&tuple)
+    noexcept(details::is_nothrow_get_tuple<K, Def, Tuple, Idx>::value
+        && !details::use_alloc<K, UCT>::value)
+{
+    static_assert(!details::is_duplicated<K, UCT>::value, "that argument is passed more than once!");
+    static_assert(!details::is_folded_flag<K, UCT>::value
+        ,"the flags folded by the namedargs::flags() are read by the get_flags() only!");
+    return details::get_impl_tuple<K, UCT>::type::get(
+        k, std::forward<Def>(def), details::int_const<std::size_t, Idx>{}
             ,std::forward<Tuple>(tuple));
 }
 
+template<typename K, typename Def, typename Tuple, typename UCT = typename std::decay<Tuple>::type>
+constexpr typename details::enable_if_tuple<typename details::default_of<K, Def>::type, UCT>::type
+get(const K &k, details::def_holder<Def> def, Tuple &&tuple)
+    noexcept(noexcept(get(k, static_cast<Def &&>(def.elem), std::forward<Tuple>(tuple))))
+{
+    return get(k, static_cast<Def &&>(def.elem), std::forward<Tuple>(tuple));
+}
+
 /*************************************************************************************************/
 // for variadic
 
 template<typename K, typename ...Args>
-typename details::disable_if_tuple<typename K::type, Args...>::type
-get(const K &k, Args && ...args) {
-    constexpr int idx = details::position<K, Args...>::value;
-    static_assert(idx != -1, "that argument seems to be necessary!");
-    return details::get_arg_impl_variadic<idx != -1>::template get(
-        k, K{}, std::forward<Args>(args)...);
+constexpr typename details::disable_if_tuple<typename K::type, Args...>::type
+get(const K &k, Args && ...args)
+    noexcept(details::is_nothrow_get_variadic<K, const K &, Args...>::value
+        && !details::use_alloc<K, Args...>::value)
+{
+    static_assert(details::position<K, Args...>::value != -1
+        ,"that argument seems to be necessary!");
+    static_assert(!details::is_duplicated<K, Args...>::value
+        ,"that argument is passed more than once!");
+    static_assert(!details::is_folded_flag<K, Args...>::value
+        ,"the flags folded by the namedargs::flags() are read by the get_flags() only!");
+    // the key itself is passed as the default, it's never used
+    return details::get_impl_variadic<K, Args...>::type::get(
+        k, k, static_cast<Args &&>(args)...);
+}
+
+// the duplicates are checked in the rest of the pack, after the default
+template<typename K, typename Def, typename ...Args>
+constexpr typename details::disable_if_tuple<
+     typename details::default_of<K, Def>::type
+    ,Args...
+>::type
+get(const K &k, Def &&def, Args && ...args)
+    noexcept(details::is_nothrow_get_variadic<K, Def, Args...>::value
+        && !details::use_alloc<K, Args...>::value)
+{
+    static_assert(!details::is_duplicated<K, Args...>::value
+        ,"that argument is passed more than once!");
+    static_assert(!details::is_folded_flag<K, Args...>::value
+        ,"the flags folded by the namedargs::flags() are read by the get_flags() only!");
+    return details::get_impl_variadic<K, Args...>::type::get(
+        k, static_cast<Def &&>(def), static_cast<Args &&>(args)...);
 }
 
 template<typename K, typename Def, typename ...Args>
-typename details::disable_if_tuple<typename K::type, Args...>::type
-get(const K &k, Def &&def, Args && ...args) {
-    constexpr int idx = details::position<K, Args...>::value;
-    return details::get_arg_impl_variadic<idx != -1>::template get(
-        k, std::forward<Def>(def), std::forward<Args>(args)...);
+constexpr typename details::disable_if_tuple<
+     typename details::default_of<K, Def>::type
+    ,Args...
+>::type
+get(const K &k, details::def_holder<Def> def, Args && ...args)
+    noexcept(noexcept(get(k, static_cast<Def &&>(def.elem), static_cast<Args &&>(args)...)))
+{
+    return get(k, static_cast<Def &&>(def.elem), static_cast<Args &&>(args)...);
 }
 
 /*************************************************************************************************/
+// views
 
-#define NAMEDARGS_PARENTHESIS_MUST_BE_PLACED_AROUND_THE_RETURN_TYPE(...) __VA_ARGS__>::type
+// the view on the specified keys of the pack, the keys which was not passed are skipped.
+// the view refers to the pack elements, thus, the pack must outlive the view.
+// the view is accepted by `get()` as any other tuple, and can be forwarded again.
+// the elements of the rvalue pack, like `std::forward_as_tuple(std::forward<Args>(a)...)`,
+// are moved by the `get()` from the rvalue view, the lvalue pack is copied from.
+template<typename Tuple, typename ...Keys>
+typename details::view_of<false, Tuple, Keys...>::type
+forward_subset(Tuple &&pack, const Keys &...) noexcept {
+    return details::view_of<false, Tuple, Keys...>::make(std::forward<Tuple>(pack));
+}
 
-#define NAMEDARGS_FUNC_ENABLE(VARIADIC, ...) \
-    typename std::enable_if< \
-        ::namedargs::details::multi_contains<::namedargs::details::types_list<decltype(__VA_ARGS__)> \
-            ,VARIADIC>::value == true \
-                ,NAMEDARGS_PARENTHESIS_MUST_BE_PLACED_AROUND_THE_RETURN_TYPE
+// the view on all keys of the pack except the specified ones.
+template<typename Tuple, typename ...Keys>
+typename details::view_of<true, Tuple, Keys...>::type
+forward_except(Tuple &&pack, const Keys &...) noexcept {
+    return details::view_of<true, Tuple, Keys...>::make(std::forward<Tuple>(pack));
+}
 
-#define NAMEDARGS_FUNC_DISABLE(VARIADIC, ...) \
-    typename std::enable_if< \
-        ::namedargs::details::multi_contains<::namedargs::details::types_list<decltype(__VA_ARGS__)> \
-            ,VARIADIC>::value == false \
-                ,NAMEDARGS_PARENTHESIS_MUST_BE_PLACED_AROUND_THE_RETURN_TYPE
+/*************************************************************************************************/
+// for flags
 
-#define NAMEDARGS_FUNC_REQUIRE(VARIADIC, ...) \
-    typename ::namedargs::details::required_ret_holder< \
-        ::namedargs::details::multi_contains<::namedargs::details::types_list<decltype(__VA_ARGS__)> \
-            ,VARIADIC>::value == true \
-                ,NAMEDARGS_PARENTHESIS_MUST_BE_PLACED_AROUND_THE_RETURN_TYPE
+// folds the flag keys into the single argument:
+// `process(args.fname = "1.txt", namedargs::flags(args.verbose = true, args.dry_run = dry))`
+// the folded flags are read by the `get_flags()` only, they are not seen by the `get()`
+// and by the NAMEDARGS_FUNC_*() macros.
+template<typename ...Flags>
+constexpr details::flag_set flags(const Flags &...f) noexcept {
+    static_assert(details::all_flags<Flags...>::value, "only the flag keys are allowed!");
+    static_assert(!details::masks_overlap<Flags...>::value, "the flags share the same bit!");
+    static_assert(!details::is_flag_duplicated<Flags...>::value, "that flag is passed more than once!");
+    return {details::all_flag_assigned(f...), details::all_flag_bits(f...)};
+}
 
-#define NAMEDARGS_FUNC_REFUSE(VARIADIC, ...) \
-    typename ::namedargs::details::refused_ret_holder< \
-        ::namedargs::details::multi_contains<::namedargs::details::types_list<decltype(__VA_ARGS__)> \
-            ,VARIADIC>::value == false \
-                ,NAMEDARGS_PARENTHESIS_MUST_BE_PLACED_AROUND_THE_RETURN_TYPE
+// the mask of the flag keys which are passed as `true`, either alone or by `namedargs::flags()`.
+// the bit of the key is tested as `get_flags(a...) & args.verbose.mask()`
+template<typename ...Args>
+constexpr typename details::disable_if_tuple<flags_type, Args...>::type
+get_flags(const Args &...args) noexcept {
+    static_assert(!details::masks_overlap<Args...>::value, "the flags share the same bit!");
+    static_assert(!details::is_flag_duplicated<Args...>::value, "that flag is passed more than once!");
+    return details::all_flag_bits(args...);
+}
+
+template<typename Tuple, typename UCT = typename std::decay<Tuple>::type>
+constexpr typename details::enable_if_tuple<flags_type, UCT>::type
+get_flags(const Tuple &tuple) noexcept {
+    static_assert(!details::masks_overlap<UCT>::value, "the flags share the same bit!");
+    static_assert(!details::is_flag_duplicated<UCT>::value, "that flag is passed more than once!");
+    return details::tuple_flag_bits(
+        tuple, typename details::make_index_list<std::tuple_size<UCT>::value>::type{});
+}
+
+// the same, but the flags which are not passed are taken from the `def`:
+// `get_flags_or(namedargs::flags(args.verbose = true), a...)`
+template<typename ...Args>
+constexpr typename details::disable_if_tuple<flags_type, Args...>::type
+get_flags_or(const details::flag_set &def, const Args &...args) noexcept {
+    static_assert(!details::masks_overlap<Args...>::value, "the flags share the same bit!");
+    static_assert(!details::is_flag_duplicated<Args...>::value, "that flag is passed more than once!");
+    return (def.bits & ~details::all_flag_assigned(args...)) | details::all_flag_bits(args...);
+}
+
+template<typename Tuple, typename UCT = typename std::decay<Tuple>::type>
+constexpr typename details::enable_if_tuple<flags_type, UCT>::type
+get_flags_or(const details::flag_set &def, const Tuple &tuple) noexcept {
+    return (def.bits & ~details::tuple_flag_assigned(
+            tuple, typename details::make_index_list<std::tuple_size<UCT>::value>::type{}))
+        | get_flags(tuple)
+    ;
+}
+
+/*************************************************************************************************/
+// for multi-valued keys
+
+// the number of occurrences of the key in the pack, it's known at compile time
+template<typename K, typename ...Args>
+constexpr std::size_t count(const K &, const Args &...) noexcept {
+    return details::count_of<K, Args...>::value;
+}
+
+// all the values of the multi-valued key in the order they are passed, collected into
+// the `std::array` of `count(k, a...)` elements. the rvalues are moved.
+template<typename K, typename ...Args>
+constexpr typename details::disable_if_tuple<
+     typename details::collect_args<K, Args...>::type
+    ,Args...
+>::type
+get_all(const K &, Args && ...args) {
+    static_assert(details::is_multi<K>::value
+        ,"only the NAMEDARGS_MULTI() keys can be collected!");
+    return details::collect_args<K, Args...>::from_args(static_cast<Args &&>(args)...);
+}
+
+template<typename K, typename Tuple, typename UCT = typename std::decay<Tuple>::type>
+constexpr typename details::collect_tuple<K, UCT>::type
+get_all(const K &, Tuple &&tuple) {
+    static_assert(details::is_multi<K>::value
+        ,"only the NAMEDARGS_MULTI() keys can be collected!");
+    return details::collect_tuple<K, UCT>::from_tuple(std::forward<Tuple>(tuple));
+}
+
+/*************************************************************************************************/
+// for explicit instantiation
+
+// the type of the pack element passed as `k = u`
+template<typename K, typename U>
+using arg_type = typename std::decay<
+    decltype(std::declval<const K &>() = std::declval<U>())
+>::type;
+
+// the type of `template<typename ...Args> R func(Args && ...)` instantiated for the call
+// with the `Args` as the rvalue args, which is the case for the `func(args.fname = ...)`.
+// used to declare the instantiation without spelling out the params.
+template<typename R, typename ...Args>
+using signature = R(Args && ...);
 
 /*************************************************************************************************/
+// for output args
 
-#define NAMEDARGS_ARG(name, type_) \
-    struct name ## _t { \
-        using type = type_; \
-        type v; \
-        template<typename U> \
-        name ## _t operator= (U &&u) const \
-        { return {std::forward<U>(u)}; }\
-    } const name{};
+// wraps the caller's storage for passing into an output key:
+// `args.result = namedargs::out(buf)`
+template<typename T>
+constexpr details::out_holder<T> out(T &v) noexcept {
+    return {&v};
+}
 
 /*************************************************************************************************/
 
 } // ns namedargs
 
+#include <named-args/macros.hpp>
+
 #endif // __NAMED_ARGS__NAMED_ARGS_HPP_INCLUDED
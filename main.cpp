@@ -27,6 +27,8 @@
 #include <named-args/named-args.hpp>
 
 #include <iostream>
+#include <memory>
+#include <cstdint>
 #include <string>
 #include <cassert>
 
@@ -52,12 +54,99 @@ struct noncopyable {
     }
 };
 
+struct copycounter {
+    static int copies;
+
+    copycounter() = default;
+    copycounter(const copycounter &) { ++copies; }
+    copycounter& operator= (const copycounter &) { ++copies; return *this; }
+    copycounter(copycounter &&) = default;
+    copycounter& operator= (copycounter &&) = default;
+};
+
+int copycounter::copies = 0;
+
+// counts the allocations made through it
+template<typename T>
+struct counting_allocator {
+    using value_type = T;
+
+    std::size_t *count = nullptr;
+
+    counting_allocator() = default;
+    counting_allocator(std::size_t *c) noexcept :count{c} {}
+    template<typename U>
+    counting_allocator(const counting_allocator<U> &a) noexcept :count{a.count} {}
+
+    T* allocate(std::size_t n) {
+        if ( count ) {
+            ++*count;
+        }
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+};
+
+template<typename T, typename U>
+bool operator== (const counting_allocator<T> &l, const counting_allocator<U> &r) noexcept
+{ return l.count == r.count; }
+template<typename T, typename U>
+bool operator!= (const counting_allocator<T> &l, const counting_allocator<U> &r) noexcept
+{ return l.count != r.count; }
+
+// counts the constructions, copies and moves
+struct tracked {
+    static int ctors;
+    static int copies;
+    static int moves;
+
+    tracked() = default;
+    tracked(int i, const std::string &s, char c) :v{s + std::to_string(i) + c} { ++ctors; }
+    tracked(const tracked &o) :v{o.v} { ++copies; }
+    tracked(tracked &&o) noexcept :v{std::move(o.v)} { ++moves; }
+
+    std::string v;
+};
+
+int tracked::ctors = 0;
+int tracked::copies = 0;
+int tracked::moves = 0;
+
+// over-aligned
+struct alignas(64) cacheline {
+    cacheline() = default;
+    cacheline(int a, int b, int c) noexcept :sum{a + b + c} {}
+
+    int sum = 0;
+};
+
+#if __cplusplus >= 201703L
+// neither copyable nor movable
+struct pinned {
+    pinned() = default;
+    pinned(int a, std::string b) :a{a}, b{std::move(b)} {}
+    pinned(const pinned &) = delete;
+    pinned(pinned &&) = delete;
+
+    int a = 0;
+    std::string b;
+};
+#endif // __cplusplus >= 201703L
+
+using counted_string = std::basic_string<char, std::char_traits<char>, counting_allocator<char>>;
+
 // declaration of args-group with it's members
 struct {
     NAMEDARGS_ARG(fname, std::string);
     NAMEDARGS_ARG(fsize, int);
     NAMEDARGS_ARG(fmode, char);
     NAMEDARGS_ARG(ipaddr, noncopyable);
+    NAMEDARGS_OUT(fdata, std::string);
+    NAMEDARGS_OUT(fcount, int);
+    NAMEDARGS_ARG(fblob, copycounter);
+    NAMEDARGS_ARG(fptr, std::unique_ptr<int>);
 } const args;
 
 /*************************************************************************************************/
@@ -106,7 +195,7 @@ int process_file_1(Args && ...a) {
 
     // get as optional.
     // it the option was not passed to the function, then 'r' will be used for 'fmode'.
-    auto fmode = namedargs::get(args.fmode, args.fmode = 'w', std::forward<Args>(a)...);
+    auto fmode = namedargs::get(args.fmode, namedargs::def(args.fmode = 'w'), std::forward<Args>(a)...);
 
     assert(fname == k_fname);
     assert(fsize == k_fsize);
@@ -173,6 +262,492 @@ NAMEDARGS_FUNC_DISABLE(Args..., args.ipaddr)
     return 1;
 }
 
+/*************************************************************************************************/
+// output args test
+
+// fname  - required
+// fdata  - required, output
+// fcount - optional, output
+
+// variadic packed as tuple
+template<typename ...Args>
+NAMEDARGS_FUNC_REQUIRE(Args..., args.fdata)
+(void) read_file_0(Args && ...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+
+    auto fname = namedargs::get(args.fname, tuple);
+
+    // references to the caller's storage
+    std::string &fdata = namedargs::get(args.fdata, tuple);
+    fdata.assign(fname).append(" data");
+
+    // if the 'fcount' was not passed to this function, then the local one will be used.
+    int unused = 0;
+    int &fcount = namedargs::get(args.fcount, args.fcount = namedargs::out(unused), tuple);
+    fcount = static_cast<int>(fdata.size());
+}
+
+// variadic NOT packed as tuple
+template<typename ...Args>
+NAMEDARGS_FUNC_REFUSE(Args..., args.fcount)
+(void) read_file_1(Args && ...a) {
+    auto fname = namedargs::get(args.fname, std::forward<Args>(a)...);
+
+    namedargs::get(args.fdata, std::forward<Args>(a)...) = fname;
+}
+
+/*************************************************************************************************/
+// forwarding test
+
+// fname - required
+// fblob - required
+
+// the innermost layer
+template<typename ...Args>
+int layer_2(Args && ...a) {
+    auto fname = namedargs::get(args.fname, std::forward<Args>(a)...);
+    auto fblob = namedargs::get(args.fblob, std::forward<Args>(a)...);
+    (void)fblob;
+
+    // the refused keys are not forwarded
+    static_assert(namedargs::details::position<decltype(args.fmode), Args...>::value == -1, "");
+    static_assert(namedargs::details::position<decltype(args.fsize), Args...>::value == -1, "");
+
+    return static_cast<int>(fname.size());
+}
+
+template<typename ...Args>
+NAMEDARGS_FUNC_REQUIRE(Args..., args.fname, args.fblob)
+(int) layer_1(Args && ...a) {
+    auto fmode = namedargs::get(args.fmode, namedargs::def(args.fmode = 'w'), std::forward<Args>(a)...);
+    assert(fmode == k_fmode);
+
+    return layer_2(namedargs::forward_except(std::forward_as_tuple(std::forward<Args>(a)...), args.fmode));
+}
+
+template<typename ...Args>
+int layer_0(Args && ...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+
+    auto fsize = namedargs::get(args.fsize, tuple);
+    assert(fsize == k_fsize);
+
+    return layer_1(namedargs::forward_subset(std::move(tuple), args.fname, args.fmode, args.fblob));
+}
+
+// the move-only key is forwarded by the view, and moved by the innermost `get()`
+template<typename ...Args>
+int owner_1(Args && ...a) {
+    std::unique_ptr<int> fptr = namedargs::get(args.fptr, std::forward<Args>(a)...);
+
+    return *fptr;
+}
+
+template<typename ...Args>
+int owner_0(Args && ...a) {
+    return owner_1(namedargs::forward_except(std::forward_as_tuple(std::forward<Args>(a)...), args.fsize));
+}
+
+/*************************************************************************************************/
+// constexpr test
+
+struct {
+    NAMEDARGS_ARG(width, int);
+    NAMEDARGS_ARG(height, int);
+    NAMEDARGS_ARG(depth, int);
+} constexpr dims{};
+
+// width  - required
+// height - required
+// depth  - optional
+
+// variadic NOT packed as tuple
+template<typename ...Args>
+constexpr int volume_0(Args && ...a) {
+    return namedargs::get(dims.width, a...)
+        * namedargs::get(dims.height, a...)
+        * namedargs::get(dims.depth, namedargs::def(dims.depth = 1), a...)
+    ;
+}
+
+#if __cplusplus >= 201402L
+// variadic packed as tuple
+template<typename ...Args>
+constexpr int volume_1(Args && ...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+
+    auto width = namedargs::get(dims.width, tuple);
+    auto height = namedargs::get(dims.height, tuple);
+    auto depth = namedargs::get(dims.depth, dims.depth = 1, tuple);
+
+    return width * height * depth;
+}
+#endif // __cplusplus >= 201402L
+
+// explicit instantiation of the body for the `volume_0(dims.width = 2, dims.height = 3)` call
+NAMEDARGS_INSTANTIATE(int, volume_0, NAMEDARGS_ARG_TYPE(dims.width, int), NAMEDARGS_ARG_TYPE(dims.height, int));
+
+/*************************************************************************************************/
+// allocator test
+
+struct {
+    NAMEDARGS_ALLOC(alloc, counting_allocator<char>);
+    NAMEDARGS_ARG(path, counted_string);
+    NAMEDARGS_ARG(query, counted_string);
+    NAMEDARGS_ARG(port, int);
+} const srv;
+
+// alloc - optional
+// path  - required
+// query - optional
+// port  - optional
+
+// variadic NOT packed as tuple
+template<typename ...Args>
+std::pair<counted_string, counted_string> handle_0(Args && ...a) {
+    counted_string path = namedargs::get(srv.path, a...);
+    counted_string query = namedargs::get(srv.query, namedargs::def(srv.query = "sort=name&order=ascending"), a...);
+
+    return {std::move(path), std::move(query)};
+}
+
+// variadic packed as tuple
+template<typename ...Args>
+std::pair<counted_string, counted_string> handle_1(Args && ...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+
+    counted_string path = namedargs::get(srv.path, tuple);
+    counted_string query = namedargs::get(srv.query, srv.query = "sort=name&order=ascending", tuple);
+
+    return {std::move(path), std::move(query)};
+}
+
+/*************************************************************************************************/
+// piecewise test
+
+struct {
+    NAMEDARGS_ARG(item, tracked);
+    NAMEDARGS_ARG(line, cacheline);
+    NAMEDARGS_ARG(name, std::string);
+#if __cplusplus >= 201703L
+    NAMEDARGS_ARG(pin, pinned);
+#endif // __cplusplus >= 201703L
+} const pw;
+
+// item - required
+// line - optional
+
+// variadic NOT packed as tuple
+template<typename ...Args>
+std::string piecewise_0(Args && ...a) {
+    tracked item = namedargs::get(pw.item, a...);
+    cacheline line = namedargs::get(pw.line, namedargs::def(pw.line.emplace(1, 2, 3)), a...);
+    assert(reinterpret_cast<std::uintptr_t>(&line) % 64 == 0);
+
+    return item.v + std::to_string(line.sum);
+}
+
+// variadic packed as tuple
+template<typename ...Args>
+std::string piecewise_1(Args && ...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+
+    tracked item = namedargs::get(pw.item, tuple);
+    cacheline line = namedargs::get(pw.line, pw.line.emplace(1, 2, 3), tuple);
+    assert(reinterpret_cast<std::uintptr_t>(&line) % 64 == 0);
+
+    return item.v + std::to_string(line.sum);
+}
+
+// name - required, fetched more than once: the ctor args are moved from by the last fetch only
+template<typename ...Args>
+std::string piecewise_3(Args && ...a) {
+    std::string name = namedargs::get(pw.name, a...);
+    auto tuple = std::forward_as_tuple(a...);
+    std::string copy = namedargs::get(pw.name, tuple);
+    std::string last = namedargs::get(pw.name, std::forward<Args>(a)...);
+
+    return name + '|' + copy + '|' + last;
+}
+
+#if __cplusplus >= 201703L
+// pin - required
+template<typename ...Args>
+std::string piecewise_2(Args && ...a) {
+    // constructed right in the `pin`, the guaranteed copy elision is required
+    pinned pin = namedargs::get(pw.pin, a...);
+
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+    pinned pin2 = namedargs::get(pw.pin, tuple);
+
+    return pin.b + std::to_string(pin.a + pin2.a);
+}
+#endif // __cplusplus >= 201703L
+
+static_assert(std::is_same<
+     namedargs::details::key_of<decltype(pw.line.emplace(1, 2, 3))>::type
+    ,std::decay<decltype(pw.line)>::type
+>::value, "");
+static_assert(noexcept(namedargs::get(pw.line, pw.line.emplace(1, 2, 3))), "");
+static_assert(!noexcept(namedargs::get(pw.item, pw.item.emplace(1, std::string{}, 'c'))), "");
+static_assert(alignof(decltype(namedargs::get(pw.line, pw.line.emplace(1, 2, 3)))) == 64, "");
+
+/*************************************************************************************************/
+// flags test
+
+struct {
+    NAMEDARGS_FLAG(verbose, 0);
+    NAMEDARGS_FLAG(dry_run, 1);
+    NAMEDARGS_FLAG(force, 17);
+} constexpr switches{};
+
+// verbose - optional, false by default
+// dry_run - optional, false by default
+// force   - optional, true by default
+
+// variadic NOT packed as tuple
+template<typename ...Args>
+constexpr namedargs::flags_type copy_file_0(Args && ...a) {
+    return namedargs::get_flags_or(namedargs::flags(switches.force = true), a...);
+}
+
+// variadic packed as tuple
+template<typename ...Args>
+namedargs::flags_type copy_file_1(Args && ...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+
+    return namedargs::get_flags_or(namedargs::flags(switches.force = true), tuple);
+}
+
+static_assert(switches.verbose.mask() == 1u && switches.force.mask() == (1u << 17), "");
+static_assert(copy_file_0() == switches.force.mask(), "");
+static_assert(copy_file_0(switches.force = false) == 0, "");
+static_assert(copy_file_0(args.fsize = 1, switches.dry_run = true)
+    == (switches.dry_run.mask() | switches.force.mask()), "");
+static_assert(copy_file_0(namedargs::flags(switches.verbose = true, switches.force = false), args.fsize = 1)
+    == switches.verbose.mask(), "");
+static_assert(namedargs::get_flags(switches.verbose = true, args.fsize = 1, switches.dry_run = false)
+    == switches.verbose.mask(), "");
+static_assert(namedargs::get_flags(args.fsize = 1) == 0, "");
+static_assert(std::is_same<decltype(switches.verbose.mask()), namedargs::flags_type>::value, "");
+
+// the same bit as the `switches.verbose`
+struct {
+    NAMEDARGS_FLAG(quiet, 0);
+} constexpr aliased{};
+
+using verbose_t = std::decay<decltype(switches.verbose)>::type;
+using force_t = std::decay<decltype(switches.force)>::type;
+using quiet_t = std::decay<decltype(aliased.quiet)>::type;
+static_assert(namedargs::details::masks_overlap<verbose_t, force_t, quiet_t>::value, "");
+static_assert(namedargs::details::masks_overlap<std::tuple<quiet_t, verbose_t>>::value, "");
+static_assert(!namedargs::details::masks_overlap<verbose_t, force_t, verbose_t, decltype(args.fsize = 1)>::value, "");
+
+// the folded flags are seen by the `get_flags()` only
+static_assert(namedargs::details::is_folded_flag<force_t, namedargs::details::flag_set>::value, "");
+static_assert(namedargs::details::is_folded_flag<force_t, std::tuple<decltype(args.fsize = 1), namedargs::details::flag_set>>::value, "");
+static_assert(!namedargs::details::is_folded_flag<force_t, force_t>::value, "");
+static_assert(!namedargs::details::is_folded_flag<decltype(args.fsize), namedargs::details::flag_set>::value, "");
+static_assert(namedargs::get(switches.verbose, namedargs::def(switches.verbose = false), switches.verbose = true), "");
+
+// the flag passed more than once is taken by its first occurrence, as by the `get()`
+static_assert(!namedargs::details::is_flag_duplicated<verbose_t, force_t, decltype(args.fsize = 1)>::value, "");
+static_assert(copy_file_0(namedargs::flags(switches.force = false), switches.force = true) == 0, "");
+static_assert(copy_file_0(namedargs::flags(switches.verbose = true), switches.verbose = false)
+    == (switches.verbose.mask() | switches.force.mask()), "");
+#if NAMEDARGS_REJECT_DUPLICATES
+static_assert(namedargs::details::is_flag_duplicated<verbose_t, decltype(args.fsize = 1), verbose_t>::value, "");
+static_assert(namedargs::details::is_flag_duplicated<std::tuple<force_t, force_t>>::value, "");
+#else
+static_assert(namedargs::get_flags(switches.verbose = false, switches.verbose = true) == 0, "");
+static_assert(namedargs::get_flags(switches.verbose = true, switches.verbose = false) == switches.verbose.mask(), "");
+static_assert(copy_file_0(switches.force = false, args.fsize = 1, switches.force = true) == 0, "");
+#endif // NAMEDARGS_REJECT_DUPLICATES
+
+/*************************************************************************************************/
+// multi-valued test
+
+struct {
+    NAMEDARGS_ARG(url, std::string);
+    NAMEDARGS_MULTI(header, std::string);
+} const http;
+
+struct {
+    NAMEDARGS_MULTI(port, int);
+} constexpr net{};
+
+// url    - required
+// header - optional, multi-valued
+
+// variadic NOT packed as tuple
+template<typename ...Args>
+std::string request_0(Args && ...a) {
+    std::string req = namedargs::get(http.url, a...);
+    for ( const auto &it: namedargs::get_all(http.header, std::forward<Args>(a)...) ) {
+        req += '|';
+        req += it;
+    }
+
+    return req;
+}
+
+// variadic packed as tuple
+template<typename ...Args>
+std::string request_1(Args && ...a) {
+    auto tuple = std::make_tuple(std::forward<Args>(a)...);
+
+    std::string req = namedargs::get(http.url, tuple);
+    for ( const auto &it: namedargs::get_all(http.header, std::move(tuple)) ) {
+        req += '|';
+        req += it;
+    }
+
+    return req;
+}
+
+#if __cplusplus >= 201402L
+template<typename ...Args>
+constexpr int sum_ports(Args && ...a) {
+    const auto ports = namedargs::get_all(net.port, a...);
+    int sum = 0;
+    for ( std::size_t i = 0; i < ports.size(); ++i ) {
+        sum += ports[i];
+    }
+
+    return sum;
+}
+#endif // __cplusplus >= 201402L
+
+static_assert(namedargs::count(net.port, net.port = 1, dims.width = 2, net.port = 3) == 2, "");
+static_assert(namedargs::count(net.port, dims.width = 2) == 0, "");
+static_assert(namedargs::get_all(net.port, net.port = 1, dims.width = 2, net.port = 3).size() == 2, "");
+static_assert(namedargs::get_all(net.port, dims.width = 2).size() == 0, "");
+// the single-valued `get()` uses the first occurrence after the default
+static_assert(namedargs::get(net.port, dims.width = 0, net.port = 1, net.port = 3) == 1, "");
+static_assert(namedargs::get(net.port, net.port = 0, net.port = 1, net.port = 3) == 1, "");
+static_assert(namedargs::get(net.port, net.port = 0, dims.width = 2) == 0, "");
+static_assert(namedargs::get(net.port, namedargs::def(net.port = 0), net.port = 1, net.port = 3) == 1, "");
+static_assert(namedargs::details::count_of<
+     decltype(net.port)
+    ,std::tuple<decltype(net.port = 1), decltype(dims.width = 2), const decltype(net.port = 1) &>
+>::value == 2, "");
+static_assert(!namedargs::details::is_duplicated<decltype(dims.width), decltype(dims.width = 1)>::value, "");
+static_assert(!namedargs::details::is_duplicated<decltype(net.port), decltype(net.port = 1), decltype(net.port = 2)>::value, "");
+#if __cplusplus >= 201402L
+static_assert(sum_ports(net.port = 1, dims.width = 2, net.port = 3, net.port = 5) == 9, "");
+static_assert(sum_ports() == 0, "");
+#endif // __cplusplus >= 201402L
+
+// the pack is forwarded as is: the element of the same key at its beginning
+// is taken as the unmarked default
+template<typename ...Args>
+constexpr int first_port(Args && ...a) {
+    return namedargs::get(net.port, a...);
+}
+
+template<typename ...Args>
+constexpr int port_or_80(Args && ...a) {
+    return namedargs::get(net.port, namedargs::def(net.port = 80), a...);
+}
+
+template<typename ...Args>
+constexpr int port_or_8080(Args && ...a) {
+    return namedargs::get(net.port, net.port = 8080, a...);
+}
+
+template<typename ...Args>
+constexpr int first_width(Args && ...a) {
+    return namedargs::get(dims.width, a...);
+}
+
+static_assert(first_port(net.port = 10) == 10, "");
+static_assert(first_port(net.port = 10, net.port = 20) == 20, "");
+static_assert(first_port(dims.width = 1, net.port = 10, net.port = 20) == 10, "");
+static_assert(port_or_80() == 80, "");
+static_assert(port_or_80(net.port = 10, net.port = 20) == 10, "");
+static_assert(port_or_8080() == 8080, "");
+static_assert(port_or_8080(dims.width = 1, net.port = 10) == 10, "");
+static_assert(first_width(dims.height = 1, dims.width = 2) == 2, "");
+#if NAMEDARGS_REJECT_DUPLICATES
+using width_t = std::decay<decltype(dims.width)>::type;
+static_assert(namedargs::details::is_duplicated<width_t, width_t, width_t>::value, "");
+#   ifdef NAMEDARGS_TEST_DUPLICATE
+// must be rejected: the `reject-duplicates` test expects the compilation to fail
+static_assert(first_width(dims.height = 1, dims.width = 1, dims.width = 2) == 1, "");
+#   endif // NAMEDARGS_TEST_DUPLICATE
+#else
+static_assert(first_width(dims.height = 1, dims.width = 1, dims.width = 2) == 1, "");
+#endif // NAMEDARGS_REJECT_DUPLICATES
+
+/*************************************************************************************************/
+// noexcept test
+
+template<typename K>
+using key_type = typename std::decay<K>::type;
+
+using fsize_t = key_type<decltype(args.fsize)>;
+using fname_t = key_type<decltype(args.fname)>;
+using fptr_t = key_type<decltype(args.fptr)>;
+using fdata_t = key_type<decltype(args.fdata)>;
+
+// deferred conversion: only for the cheap to copy source of the expensive to construct value
+static_assert(!std::is_same<fname_t, decltype(args.fname = "1.txt")>::value, "");
+static_assert(std::is_same<fname_t, decltype(args.fname = std::string{})>::value, "");
+static_assert(std::is_same<fsize_t, decltype(args.fsize = 'c')>::value, "");
+static_assert(namedargs::details::position<fname_t, fsize_t, decltype(args.fname = "1.txt")>::value == 1, "");
+
+// the element types for the explicit instantiation
+static_assert(std::is_same<NAMEDARGS_ARG_TYPE(args.fname, const char *), decltype(args.fname = "1.txt")>::value, "");
+static_assert(std::is_same<NAMEDARGS_ARG_TYPE(args.fname, std::string), fname_t>::value, "");
+static_assert(std::is_same<NAMEDARGS_ARG_TYPE(args.fdata, namedargs::details::out_holder<std::string>), fdata_t>::value, "");
+static_assert(std::is_same<namedargs::signature<int, fname_t, fsize_t>, int(fname_t &&, fsize_t &&)>::value, "");
+
+// the allocator doesn't affect the non-allocator-aware values
+using path_t = key_type<decltype(srv.path)>;
+using alloc_t = key_type<decltype(srv.alloc)>;
+static_assert(namedargs::details::use_alloc<path_t, alloc_t, path_t>::value, "");
+static_assert(!namedargs::details::use_alloc<path_t, path_t>::value, "");
+static_assert(!namedargs::details::use_alloc<fsize_t, alloc_t, fsize_t>::value, "");
+static_assert(namedargs::details::use_alloc<path_t, std::tuple<path_t, alloc_t>>::value, "");
+static_assert(noexcept(namedargs::get(srv.port, namedargs::def(srv.port = 1), std::declval<alloc_t>())), "");
+
+// trivial type
+static_assert(noexcept(args.fsize = 1), "");
+static_assert(noexcept(namedargs::get(args.fsize, std::declval<fsize_t>())), "");
+static_assert(noexcept(namedargs::get(args.fsize, std::declval<fsize_t &>())), "");
+static_assert(noexcept(namedargs::get(args.fsize, namedargs::def(args.fsize = 1), std::declval<fname_t>())), "");
+static_assert(noexcept(namedargs::get(args.fsize, std::declval<std::tuple<fsize_t> &>())), "");
+static_assert(noexcept(namedargs::get(args.fsize, args.fsize = 1, std::declval<std::tuple<fname_t> &>())), "");
+static_assert(std::is_nothrow_move_constructible<fsize_t>::value, "");
+
+// std::string: moving is noexcept, copying is not
+static_assert(noexcept(args.fname = std::declval<std::string>()), "");
+static_assert(!noexcept(args.fname = std::declval<const std::string &>()), "");
+// the conversion from the `const char *` is deferred until the `get()`
+static_assert(noexcept(args.fname = "1.txt"), "");
+static_assert(!noexcept(namedargs::get(args.fname, args.fname = "1.txt")), "");
+static_assert(noexcept(namedargs::get(args.fname, std::declval<fname_t>())), "");
+static_assert(!noexcept(namedargs::get(args.fname, std::declval<fname_t &>())), "");
+static_assert(noexcept(namedargs::get(args.fname, std::declval<std::tuple<fname_t>>())), "");
+static_assert(!noexcept(namedargs::get(args.fname, std::declval<std::tuple<fname_t> &>())), "");
+static_assert(noexcept(namedargs::get(args.fname, namedargs::def(std::declval<fname_t>()), std::declval<fsize_t>())), "");
+static_assert(!noexcept(namedargs::get(args.fname, namedargs::def(std::declval<fname_t &>()), std::declval<fsize_t>())), "");
+static_assert(!noexcept(namedargs::get(args.fname, std::declval<fname_t>(), std::declval<std::tuple<fname_t> &>())), "");
+static_assert(std::is_nothrow_move_constructible<fname_t>::value, "");
+
+// move-only type
+static_assert(noexcept(args.fptr = std::declval<std::unique_ptr<int>>()), "");
+static_assert(noexcept(namedargs::get(args.fptr, std::declval<fptr_t>())), "");
+static_assert(noexcept(namedargs::get(args.fptr, std::declval<std::tuple<fptr_t>>())), "");
+static_assert(noexcept(namedargs::get(args.fptr, std::declval<fptr_t>(), std::declval<std::tuple<fptr_t> &>())), "");
+static_assert(noexcept(namedargs::get(args.fptr, namedargs::def(std::declval<fptr_t>()), std::declval<fsize_t>())), "");
+static_assert(std::is_nothrow_move_constructible<fptr_t>::value, "");
+
+// output key
+static_assert(noexcept(args.fdata = namedargs::out(std::declval<std::string &>())), "");
+static_assert(noexcept(namedargs::get(args.fdata, std::declval<fdata_t>())), "");
+static_assert(noexcept(namedargs::get(args.fdata, std::declval<std::tuple<fdata_t> &>())), "");
+
 /*************************************************************************************************/
 
 template<std::size_t I, typename T, typename ...Args>
@@ -213,6 +788,14 @@ int main(int argc, char **) {
     static_assert(tuple_elem_equal<0, int>(std::move(argc)) == true, "");
     static_assert(tuple_elem_equal<0, int>(std::forward<int>(argc)) == true, "");
 
+    static_assert(volume_0(dims.width = 2, dims.height = 3) == 6, "");
+    static_assert(volume_0(dims.depth = 4, dims.height = 3, dims.width = 2) == 24, "");
+    static_assert((dims.width = 5).v == 5, "");
+#if __cplusplus >= 201402L
+    static_assert(volume_1(dims.width = 2, dims.height = 3) == 6, "");
+    static_assert(volume_1(dims.depth = 4, dims.height = 3, dims.width = 2) == 24, "");
+#endif // __cplusplus >= 201402L
+
 // variadic packed as tuple
     // the order of the specified arguments doesn't matter!
     int r = process_file_0(
@@ -284,6 +867,169 @@ int main(int argc, char **) {
     );
     assert(nc2.v == "192.168.1.102");
 
+// output args test
+
+    std::string fdata;
+    int fcount = 0;
+    read_file_0(
+         args.fcount = namedargs::out(fcount)
+        ,args.fname = k_fname
+        ,args.fdata = namedargs::out(fdata)
+    );
+    assert(fdata == "1.txt data");
+    assert(fcount == 10);
+
+    read_file_0(
+         args.fdata = namedargs::out(fdata)
+        ,args.fname = "2.txt"
+    );
+    assert(fdata == "2.txt data");
+    assert(fcount == 10);
+
+    read_file_1(
+         args.fdata = namedargs::out(fdata)
+        ,args.fname = k_fname
+    );
+    assert(fdata == k_fname);
+
+// flags test
+
+    namedargs::flags_type flags = copy_file_1(
+         args.fname = k_fname
+        ,switches.verbose = argc > 0
+        ,switches.force = false
+    );
+    assert(flags == switches.verbose.mask());
+
+    flags = copy_file_1(namedargs::flags(switches.dry_run = true, switches.verbose = argc < 0));
+    assert(flags == (switches.dry_run.mask() | switches.force.mask()));
+
+// multi-valued test
+
+    std::string accept = "Accept: */*";
+    std::string req = request_0(
+         http.header = "Host: localhost"
+        ,http.url = "/index.html"
+        ,http.header = accept
+        ,http.header = std::string{"Connection: close"}
+    );
+    assert(req == "/index.html|Host: localhost|Accept: */*|Connection: close");
+    assert(accept == "Accept: */*");
+
+    req = request_1(http.url = "/", http.header = accept, http.header = "Host: localhost");
+    assert(req == "/|Accept: */*|Host: localhost");
+
+    req = request_1(http.url = "/");
+    assert(req == "/");
+
+// allocator test
+
+    const char *k_path = "/usr/share/doc/named-args/README.md";
+    std::size_t allocs = 0;
+    auto h0 = handle_0(srv.path = k_path, srv.alloc = counting_allocator<char>{&allocs});
+    assert(h0.first == k_path && h0.second == "sort=name&order=ascending");
+    // both the converted value and the default
+    assert(allocs == 2);
+    assert(h0.first.get_allocator().count == &allocs);
+    assert(h0.second.get_allocator().count == &allocs);
+
+    // the required key isn't the first one
+    allocs = 0;
+    auto h4 = handle_0(srv.alloc = counting_allocator<char>{&allocs}, srv.path = k_path);
+    assert(h4.first == k_path);
+    assert(allocs == 2);
+
+    allocs = 0;
+    auto h1 = handle_0(srv.path = k_path);
+    assert(allocs == 0);
+    assert(h1.first.get_allocator().count == nullptr);
+
+    // the value is taken from the pack
+    allocs = 0;
+    counted_string query{"sort=size&order=descending"};
+    auto h2 = handle_1(
+         srv.alloc = counting_allocator<char>{&allocs}
+        ,srv.query = query
+        ,srv.path = k_path
+        ,srv.port = 80
+    );
+    assert(h2.first == k_path && h2.second == query);
+    assert(allocs == 2);
+    assert(h2.second.get_allocator().count == &allocs);
+
+    allocs = 0;
+    auto h3 = handle_1(srv.alloc = counting_allocator<char>{&allocs}, srv.path = k_path);
+    assert(h3.second == "sort=name&order=ascending");
+    assert(allocs == 2);
+
+// piecewise test
+
+    std::string prefix = "item-";
+    std::string pws = piecewise_0(pw.item.emplace(1, prefix, '!'));
+    assert(pws == "item-1!6");
+    // constructed once, and neither copied nor moved
+    assert(tracked::ctors == 1 && tracked::copies == 0 && tracked::moves == 0);
+
+    pws = piecewise_1(pw.line.emplace(10, 20, 30), pw.item.emplace(2, prefix, '?'));
+    assert(pws == "item-2?60");
+    assert(tracked::ctors == 2 && tracked::copies == 0 && tracked::moves == 0);
+
+    pws = piecewise_0(pw.line.emplace(10, 20, 30), pw.item.emplace(2, prefix, '?'));
+    assert(pws == "item-2?60");
+    assert(tracked::ctors == 3 && tracked::copies == 0 && tracked::moves == 0);
+
+    std::string name(32, 'n');
+    pws = piecewise_3(pw.name.emplace(std::move(name)));
+    assert(pws == std::string(32, 'n') + '|' + std::string(32, 'n') + '|' + std::string(32, 'n'));
+    assert(name.empty());
+
+#if __cplusplus >= 201703L
+    pws = piecewise_2(pw.pin.emplace(7, prefix));
+    assert(pws == "item-14");
+#endif // __cplusplus >= 201703L
+
+// forwarding test
+
+    copycounter blob;
+
+    // the only copy - in the `get()`
+    auto pack = std::make_tuple(
+         args.fname = k_fname
+        ,args.fblob = std::move(blob)
+    );
+    copycounter::copies = 0;
+    int len = layer_2(pack);
+    assert(len == 5);
+    assert(copycounter::copies == 1);
+
+    // three layers, the rvalue views are moved from by the innermost `get()`
+    copycounter::copies = 0;
+    len = layer_0(
+         args.fblob = std::move(blob)
+        ,args.fname = k_fname
+        ,args.fsize = k_fsize
+        ,args.fmode = k_fmode
+    );
+    assert(len == 5);
+    assert(copycounter::copies == 0);
+
+    int owned = owner_0(args.fsize = k_fsize, args.fptr = std::unique_ptr<int>(new int(42)));
+    assert(owned == 42);
+
+// deferred value lifetime test
+
+    // the pointer is kept by the pack, so the pack refers to the caller's buffer
+    char fbuf[] = "1.txt";
+    auto borrowing = std::make_tuple(args.fname = fbuf);
+    fbuf[0] = '2';
+    assert(namedargs::get(args.fname, borrowing) == "2.txt");
+
+    // the value of the key type is owned by the pack
+    auto owning = std::make_tuple(args.fname = std::string{fbuf});
+    fbuf[0] = '3';
+    assert(namedargs::get(args.fname, owning) == "2.txt");
+    assert(namedargs::get(args.fname, borrowing) == "3.txt");
+
     return r;
 }
 